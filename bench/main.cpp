@@ -4,71 +4,143 @@
 //
 // Note, associated data size is kept constant for all benchmark cases !
 
-// TinyJambu-128 encrypt/ decrypt routines
-BENCHMARK(tinyjambu_128_encrypt)->Args({ 64, 32 });
-BENCHMARK(tinyjambu_128_decrypt)->Args({ 64, 32 });
-
-BENCHMARK(tinyjambu_128_encrypt)->Args({ 128, 32 });
-BENCHMARK(tinyjambu_128_decrypt)->Args({ 128, 32 });
-
-BENCHMARK(tinyjambu_128_encrypt)->Args({ 256, 32 });
-BENCHMARK(tinyjambu_128_decrypt)->Args({ 256, 32 });
-
-BENCHMARK(tinyjambu_128_encrypt)->Args({ 512, 32 });
-BENCHMARK(tinyjambu_128_decrypt)->Args({ 512, 32 });
-
-BENCHMARK(tinyjambu_128_encrypt)->Args({ 1024, 32 });
-BENCHMARK(tinyjambu_128_decrypt)->Args({ 1024, 32 });
-
-BENCHMARK(tinyjambu_128_encrypt)->Args({ 2048, 32 });
-BENCHMARK(tinyjambu_128_decrypt)->Args({ 2048, 32 });
-
-BENCHMARK(tinyjambu_128_encrypt)->Args({ 4096, 32 });
-BENCHMARK(tinyjambu_128_decrypt)->Args({ 4096, 32 });
-
-// TinyJambu-192 encrypt/ decrypt routines
-BENCHMARK(tinyjambu_192_encrypt)->Args({ 64, 32 });
-BENCHMARK(tinyjambu_192_decrypt)->Args({ 64, 32 });
-
-BENCHMARK(tinyjambu_192_encrypt)->Args({ 128, 32 });
-BENCHMARK(tinyjambu_192_decrypt)->Args({ 128, 32 });
-
-BENCHMARK(tinyjambu_192_encrypt)->Args({ 256, 32 });
-BENCHMARK(tinyjambu_192_decrypt)->Args({ 256, 32 });
-
-BENCHMARK(tinyjambu_192_encrypt)->Args({ 512, 32 });
-BENCHMARK(tinyjambu_192_decrypt)->Args({ 512, 32 });
-
-BENCHMARK(tinyjambu_192_encrypt)->Args({ 1024, 32 });
-BENCHMARK(tinyjambu_192_decrypt)->Args({ 1024, 32 });
-
-BENCHMARK(tinyjambu_192_encrypt)->Args({ 2048, 32 });
-BENCHMARK(tinyjambu_192_decrypt)->Args({ 2048, 32 });
-
-BENCHMARK(tinyjambu_192_encrypt)->Args({ 4096, 32 });
-BENCHMARK(tinyjambu_192_decrypt)->Args({ 4096, 32 });
-
-// TinyJambu-256 encrypt/ decrypt routines
-BENCHMARK(tinyjambu_256_encrypt)->Args({ 64, 32 });
-BENCHMARK(tinyjambu_256_decrypt)->Args({ 64, 32 });
-
-BENCHMARK(tinyjambu_256_encrypt)->Args({ 128, 32 });
-BENCHMARK(tinyjambu_256_decrypt)->Args({ 128, 32 });
-
-BENCHMARK(tinyjambu_256_encrypt)->Args({ 256, 32 });
-BENCHMARK(tinyjambu_256_decrypt)->Args({ 256, 32 });
-
-BENCHMARK(tinyjambu_256_encrypt)->Args({ 512, 32 });
-BENCHMARK(tinyjambu_256_decrypt)->Args({ 512, 32 });
-
-BENCHMARK(tinyjambu_256_encrypt)->Args({ 1024, 32 });
-BENCHMARK(tinyjambu_256_decrypt)->Args({ 1024, 32 });
-
-BENCHMARK(tinyjambu_256_encrypt)->Args({ 2048, 32 });
-BENCHMARK(tinyjambu_256_decrypt)->Args({ 2048, 32 });
-
-BENCHMARK(tinyjambu_256_encrypt)->Args({ 4096, 32 });
-BENCHMARK(tinyjambu_256_decrypt)->Args({ 4096, 32 });
+#define CT_LENS { 64, 128, 256, 512, 1024, 2048, 4096, 16384, 65536 }
+
+// TinyJambu-{128, 192, 256} encrypt/ decrypt/ verify routines, computing 32/
+// 64/ 128 feedback bits per iteration, all of them without loop or 64 of them
+// on 64 -bit limbs, all side by side in same binary
+#define BENCH_AEAD(fn)                                                         \
+  BENCHMARK_TEMPLATE(fn, fbk_t::fbk_32)->ArgsProduct({ CT_LENS, { 32 } });     \
+  BENCHMARK_TEMPLATE(fn, fbk_t::fbk_64)->ArgsProduct({ CT_LENS, { 32 } });     \
+  BENCHMARK_TEMPLATE(fn, fbk_t::fbk_128)->ArgsProduct({ CT_LENS, { 32 } });    \
+  BENCHMARK_TEMPLATE(fn, fbk_t::fbk_all)->ArgsProduct({ CT_LENS, { 32 } });    \
+  BENCHMARK_TEMPLATE(fn, fbk_t::fbk_u64)->ArgsProduct({ CT_LENS, { 32 } });
+
+BENCH_AEAD(tinyjambu_128_encrypt);
+BENCH_AEAD(tinyjambu_128_decrypt);
+BENCH_AEAD(tinyjambu_128_verify);
+
+BENCH_AEAD(tinyjambu_192_encrypt);
+BENCH_AEAD(tinyjambu_192_decrypt);
+BENCH_AEAD(tinyjambu_192_verify);
+
+BENCH_AEAD(tinyjambu_256_encrypt);
+BENCH_AEAD(tinyjambu_256_decrypt);
+BENCH_AEAD(tinyjambu_256_verify);
+
+// TinyJambu-{128, 192, 256} permutation, for nonce setup & key setup rounds,
+// computing 32/ 64/ 128 feedback bits per iteration, all of them without loop
+// or 64 of them on 64 -bit limbs
+#define BENCH_PERMUTE(v, rounds)                                               \
+  BENCHMARK_TEMPLATE(tinyjambu_permute, v, rounds, fbk_t::fbk_32);             \
+  BENCHMARK_TEMPLATE(tinyjambu_permute, v, rounds, fbk_t::fbk_64);             \
+  BENCHMARK_TEMPLATE(tinyjambu_permute, v, rounds, fbk_t::fbk_128);            \
+  BENCHMARK_TEMPLATE(tinyjambu_permute, v, rounds, fbk_t::fbk_all);            \
+  BENCHMARK_TEMPLATE(tinyjambu_permute, v, rounds, fbk_t::fbk_u64);
+
+BENCH_PERMUTE(tinyjambu::variant::key_128, 640);
+BENCH_PERMUTE(tinyjambu::variant::key_128, 1024);
+
+BENCH_PERMUTE(tinyjambu::variant::key_192, 640);
+BENCH_PERMUTE(tinyjambu::variant::key_192, 1152);
+
+BENCH_PERMUTE(tinyjambu::variant::key_256, 640);
+BENCH_PERMUTE(tinyjambu::variant::key_256, 1280);
+
+// Batched TinyJambu-{128, 192, 256} encrypt routines
+BENCHMARK(tinyjambu_128_encrypt_batch)->Args({ 64, 32 });
+BENCHMARK(tinyjambu_128_encrypt_batch)->Args({ 4096, 32 });
+
+BENCHMARK(tinyjambu_192_encrypt_batch)->Args({ 64, 32 });
+BENCHMARK(tinyjambu_192_encrypt_batch)->Args({ 4096, 32 });
+
+BENCHMARK(tinyjambu_256_encrypt_batch)->Args({ 64, 32 });
+BENCHMARK(tinyjambu_256_encrypt_batch)->Args({ 4096, 32 });
+
+// Interleaved TinyJambu-{128, 192, 256} encrypt routines, for 2/ 4 messages
+BENCHMARK_TEMPLATE(tinyjambu_128_encrypt_interleaved, 2)->Args({ 4096, 32 });
+BENCHMARK_TEMPLATE(tinyjambu_128_encrypt_interleaved, 4)->Args({ 4096, 32 });
+
+BENCHMARK_TEMPLATE(tinyjambu_192_encrypt_interleaved, 2)->Args({ 4096, 32 });
+BENCHMARK_TEMPLATE(tinyjambu_192_encrypt_interleaved, 4)->Args({ 4096, 32 });
+
+BENCHMARK_TEMPLATE(tinyjambu_256_encrypt_interleaved, 2)->Args({ 4096, 32 });
+BENCHMARK_TEMPLATE(tinyjambu_256_encrypt_interleaved, 4)->Args({ 4096, 32 });
+
+// Structure-of-arrays TinyJambu-{128, 192, 256} encrypt routines, for 1024
+// fixed-size records, compared against one-shot encrypt routine on each record
+#define BENCH_RECORDS(v)                                                       \
+  BENCHMARK_TEMPLATE(tinyjambu_encrypt_records, v, true)                       \
+    ->ArgsProduct({ { 32, 64, 128 }, { 16 } });                                \
+  BENCHMARK_TEMPLATE(tinyjambu_encrypt_records, v, false)                      \
+    ->ArgsProduct({ { 32, 64, 128 }, { 16 } });
+
+BENCH_RECORDS(tinyjambu::variant::key_128);
+BENCH_RECORDS(tinyjambu::variant::key_192);
+BENCH_RECORDS(tinyjambu::variant::key_256);
+
+// Fixed-length TinyJambu-{128, 192, 256} encrypt routines, for few common
+// record shapes, compared against runtime length encrypt routine
+#define BENCH_FIXED(v, ad_len, ct_len)                                         \
+  BENCHMARK_TEMPLATE(tinyjambu_encrypt_fixed, v, ad_len, ct_len, true);        \
+  BENCHMARK_TEMPLATE(tinyjambu_encrypt_fixed, v, ad_len, ct_len, false);
+
+BENCH_FIXED(tinyjambu::variant::key_128, 16, 48);
+BENCH_FIXED(tinyjambu::variant::key_128, 13, 61);
+BENCH_FIXED(tinyjambu::variant::key_192, 16, 48);
+BENCH_FIXED(tinyjambu::variant::key_256, 16, 48);
+
+// Multi-buffer TinyJambu-{128, 192, 256} job manager, for 256 messages of
+// mixed length ( every eighth one is long ), compared against batch encrypt
+// routine, processing N messages at a time
+#define BENCH_MIXED(v)                                                         \
+  BENCHMARK_TEMPLATE(tinyjambu_encrypt_mixed, v, true)                         \
+    ->ArgsProduct({ { 64 }, { 1024, 4096 } });                                 \
+  BENCHMARK_TEMPLATE(tinyjambu_encrypt_mixed, v, false)                        \
+    ->ArgsProduct({ { 64 }, { 1024, 4096 } });
+
+BENCH_MIXED(tinyjambu::variant::key_128);
+BENCH_MIXED(tinyjambu::variant::key_192);
+BENCH_MIXED(tinyjambu::variant::key_256);
+
+// TinyJambu-{128, 192, 256} encrypt routines, using reusable key context
+BENCHMARK(tinyjambu_128_encrypt_ctx)->Args({ 64, 32 });
+BENCHMARK(tinyjambu_192_encrypt_ctx)->Args({ 64, 32 });
+BENCHMARK(tinyjambu_256_encrypt_ctx)->Args({ 64, 32 });
+
+// TinyJambu-{128, 192, 256} encrypt routines, under compile-time secret key,
+// compared against runtime key context
+#define BENCH_STATIC_KEY(v)                                                    \
+  BENCHMARK_TEMPLATE(tinyjambu_encrypt_static_key, v, true)                    \
+    ->ArgsProduct({ { 48, 1024 }, { 16 } });                                   \
+  BENCHMARK_TEMPLATE(tinyjambu_encrypt_static_key, v, false)                   \
+    ->ArgsProduct({ { 48, 1024 }, { 16 } });
+
+BENCH_STATIC_KEY(tinyjambu::variant::key_128);
+BENCH_STATIC_KEY(tinyjambu::variant::key_192);
+BENCH_STATIC_KEY(tinyjambu::variant::key_256);
+
+// Multi-threaded TinyJambu-{128, 192, 256} encrypt routines, using 1/ 2/ 4/ 8
+// workers, measured in wall-clock time
+#define BENCH_PARALLEL(v)                                                      \
+  BENCHMARK_TEMPLATE(tinyjambu_encrypt_parallel, v)                            \
+    ->ArgsProduct({ { 64, 4096 }, { 32 }, { 1, 2, 4, 8 } })                    \
+    ->UseRealTime();
+
+BENCH_PARALLEL(tinyjambu::variant::key_128);
+BENCH_PARALLEL(tinyjambu::variant::key_192);
+BENCH_PARALLEL(tinyjambu::variant::key_256);
+
+// Lock-free TinyJambu-{128, 192, 256} pipeline stage, using 1/ 2/ 4 workers,
+// measured in wall-clock time
+#define BENCH_PIPELINE(v)                                                      \
+  BENCHMARK_TEMPLATE(tinyjambu_encrypt_pipeline, v)                            \
+    ->ArgsProduct({ { 64 }, { 16 }, { 1, 2, 4 } })                             \
+    ->UseRealTime();
+
+BENCH_PIPELINE(tinyjambu::variant::key_128);
+BENCH_PIPELINE(tinyjambu::variant::key_192);
+BENCH_PIPELINE(tinyjambu::variant::key_256);
 
 // main function to make it executable
 BENCHMARK_MAIN();
@@ -0,0 +1,451 @@
+#pragma once
+#include "stream.hpp"
+#include <algorithm>
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+// C++20 coroutine based TinyJambu-{128, 192, 256} AEAD, which processes
+// associated data & plain/ cipher text in bounded slices, suspending between
+// slices, so that a long message doesn't block an event loop ( or coroutine
+// executor ) for as long as it takes to process whole of it.
+//
+// Note, this header is not included by `tinyjambu_{128, 192, 256}.hpp`, so
+// that only its users need compiler support for coroutines ( say GCC 10 with
+// `-fcoroutines` ).
+namespace tinyjambu {
+
+// Plain/ cipher text ( or associated data ) bytes processed between two
+// consecutive suspension points, by default
+constexpr size_t SLICE_BYTES = 1ul << 14;
+
+// Executor, resuming a suspended coroutine, by invoking `post(ctx, handle)`,
+// which is expected to enqueue `handle` into run queue of an event loop (
+// keeping slices on that loop's thread, interleaved with other work ) or of a
+// worker pool ( offloading slices to pool's threads ), which later invokes
+// `handle.resume()`. A default constructed executor never suspends, so that
+// whole message is processed at once.
+//
+// Note, `post` may resume coroutine before it returns ( say on another thread
+// ), so it must not touch `handle` after enqueuing it.
+struct executor_t
+{
+  void (*post)(void*, std::coroutine_handle<>) = nullptr;
+  void* ctx = nullptr;
+};
+
+// Awaitable, which suspends calling coroutine, handing it to executor for
+// resumption, unless it's a default constructed one
+struct reschedule
+{
+  const executor_t exec;
+
+  bool await_ready() const noexcept { return exec.post == nullptr; }
+  void await_suspend(std::coroutine_handle<> h) const
+  {
+    // copy, as coroutine frame ( holding `this` ) may be gone once posted
+    const executor_t e = exec;
+    e.post(e.ctx, h);
+  }
+  void await_resume() const noexcept {}
+};
+
+// Result of a coroutine, returning value of type T
+template<typename T>
+struct task_result
+{
+  T value_{};
+
+  void return_value(const T value) { value_ = value; }
+};
+
+// Result of a coroutine, returning nothing
+template<>
+struct task_result<void>
+{
+  void return_void() {}
+};
+
+// Lazily started coroutine, producing value of type T, which is either awaited
+// from another coroutine ( which is resumed, once this one completes ) or
+// started from non-coroutine code, using `start`, where completion is polled
+// using `done`, before reading `result`.
+template<typename T = void>
+class task
+{
+public:
+  struct promise_type;
+  using handle_t = std::coroutine_handle<promise_type>;
+
+private:
+  // Resumes awaiting coroutine ( if any ), once this one completes
+  struct final_awaiter
+  {
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(handle_t h) const noexcept
+    {
+      promise_type& p = h.promise();
+      const std::coroutine_handle<> next = p.next_;
+
+      // frame may be destroyed right after this, by a thread polling `done`
+      p.done_.store(true, std::memory_order_release);
+
+      if (next) {
+        return next;
+      }
+      return std::noop_coroutine();
+    }
+    void await_resume() const noexcept {}
+  };
+
+  handle_t h_;
+
+public:
+  struct promise_type : task_result<T>
+  {
+    std::coroutine_handle<> next_;
+    std::atomic<bool> done_{ false };
+
+    task get_return_object() { return task{ handle_t::from_promise(*this) }; }
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    final_awaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() const noexcept { std::terminate(); }
+  };
+
+  explicit task(const handle_t h)
+    : h_{ h }
+  {
+  }
+
+  task(task&& t) noexcept
+    : h_{ std::exchange(t.h_, {}) }
+  {
+  }
+
+  task(const task&) = delete;
+  task& operator=(const task&) = delete;
+  task& operator=(task&&) = delete;
+
+  ~task()
+  {
+    if (h_) {
+      h_.destroy();
+    }
+  }
+
+  // Runs coroutine on calling thread, until it completes or suspends for the
+  // first time, which must be invoked at most once & only if it's not awaited
+  void start() { h_.resume(); }
+
+  // Whether coroutine has completed, which can be polled from any thread
+  bool done() const
+  {
+    return h_.promise().done_.load(std::memory_order_acquire);
+  }
+
+  // Value returned by coroutine, which must be read only after it's `done`
+  T result() const
+  {
+    if constexpr (!std::is_void_v<T>) {
+      return h_.promise().value_;
+    }
+  }
+
+  // Awaiting a task starts it, resuming awaiting coroutine once it completes
+  bool await_ready() const noexcept { return false; }
+  std::coroutine_handle<> await_suspend(const std::coroutine_handle<> next)
+  {
+    h_.promise().next_ = next;
+    return h_;
+  }
+  T await_resume() const { return result(); }
+};
+
+// Coroutine based TinyJambu-{128, 192, 256} Authenticated Encryption, which
+// produces same cipher text & authentication tag as one-shot `encrypt`, while
+// processing associated data & plain text using `stream`, in slices of
+// `slice` ( > 0 ) -bytes, suspending ( via `exec` ) before each of them.
+//
+// Note, all buffers must stay alive until returned task completes.
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+inline task<void>
+async_encrypt(const uint8_t* const key,        // secret key
+              const uint8_t* const nonce,      // 96 -bit public message nonce
+              const uint8_t* const data,       // associated data
+              const size_t data_len,           // associated data byte length
+              const uint8_t* const text,       // plain text
+              uint8_t* const cipher,           // cipher text
+              const size_t ct_len,             // plain/ cipher text byte length
+              uint8_t* const tag,              // 64 -bit authentication tag
+              const executor_t exec = {},      // resumes suspended coroutine
+              const size_t slice = SLICE_BYTES // bytes processed per slice
+)
+{
+  co_await reschedule{ exec };
+
+  stream<v, direction_t::encrypt, fbk> s{ key, nonce };
+
+  for (size_t off = 0; off < data_len; off += slice) {
+    if (off > 0) {
+      co_await reschedule{ exec };
+    }
+    s.update_ad(data + off, std::min(slice, data_len - off));
+  }
+
+  for (size_t off = 0; off < ct_len; off += slice) {
+    if (off > 0 || data_len > 0) {
+      co_await reschedule{ exec };
+    }
+    s.update(text + off, cipher + off, std::min(slice, ct_len - off));
+  }
+
+  s.finalize(tag);
+}
+
+// Coroutine based TinyJambu-{128, 192, 256} Verified Decryption, which
+// produces same plain text & verification flag as one-shot `decrypt`, while
+// processing associated data & cipher text using `stream`, in slices of
+// `slice` ( > 0 ) -bytes, suspending ( via `exec` ) before each of them.
+//
+// Note, all buffers must stay alive until returned task completes.
+//
+// Note, plain text is written slice by slice, before authentication tag is
+// verified, so don't consume it until task completes with truth value. If
+// verification fails, whole plain text is zeroed.
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+inline task<bool>
+async_decrypt(const uint8_t* const key,        // secret key
+              const uint8_t* const nonce,      // 96 -bit public message nonce
+              const uint8_t* const tag,        // 64 -bit authentication tag
+              const uint8_t* const data,       // associated data
+              const size_t data_len,           // associated data byte length
+              const uint8_t* const cipher,     // cipher text
+              uint8_t* const text,             // plain text
+              const size_t ct_len,             // cipher/ plain text byte length
+              const executor_t exec = {},      // resumes suspended coroutine
+              const size_t slice = SLICE_BYTES // bytes processed per slice
+)
+{
+  co_await reschedule{ exec };
+
+  stream<v, direction_t::decrypt, fbk> s{ key, nonce };
+
+  for (size_t off = 0; off < data_len; off += slice) {
+    if (off > 0) {
+      co_await reschedule{ exec };
+    }
+    s.update_ad(data + off, std::min(slice, data_len - off));
+  }
+
+  for (size_t off = 0; off < ct_len; off += slice) {
+    if (off > 0 || data_len > 0) {
+      co_await reschedule{ exec };
+    }
+    s.update(cipher + off, text + off, std::min(slice, ct_len - off));
+  }
+
+  const bool flag = s.verify(tag);
+
+  // prevent release of unverified plain text ( RUP )
+  std::memset(text, 0, !flag * ct_len);
+  co_return flag;
+}
+
+}
+
+// Coroutine based TinyJambu-128 AEAD
+namespace tinyjambu_128 {
+
+// Coroutine based TinyJambu-128 Authenticated Encryption, which processes
+// associated data & plain text in slices of `slice` -bytes, suspending ( via
+// `exec` ) before each of them, so that a long message doesn't block calling
+// thread's event loop. Produces same cipher text & authentication tag as
+// `encrypt`, once returned task completes.
+//
+// Note, all buffers must stay alive until returned task completes.
+template<const fbk_t fbk = DEFAULT_FBK>
+inline tinyjambu::task<void>
+async_encrypt(
+  const uint8_t* const key,                   // 128 -bit secret key
+  const uint8_t* const nonce,                 // 96 -bit public message nonce
+  const uint8_t* const data,                  // associated data
+  const size_t data_len,                      // associated data byte length
+  const uint8_t* const text,                  // plain text
+  uint8_t* const cipher,                      // cipher text
+  const size_t ct_len,                        // plain/ cipher text byte length
+  uint8_t* const tag,                         // 64 -bit authentication tag
+  const tinyjambu::executor_t exec = {},      // resumes suspended coroutine
+  const size_t slice = tinyjambu::SLICE_BYTES // bytes per slice
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_128;
+  return tinyjambu::async_encrypt<v, fbk>(
+    key, nonce, data, data_len, text, cipher, ct_len, tag, exec, slice);
+}
+
+// Coroutine based TinyJambu-128 Verified Decryption, which processes associated
+// data & cipher text in slices of `slice` -bytes, suspending ( via `exec` )
+// before each of them. Produces same plain text & verification flag as
+// `decrypt`, once returned task completes.
+//
+// Note, all buffers must stay alive until returned task completes.
+//
+// Note, if task's result is not truth value, plain text is zeroed, so don't
+// consume it !
+template<const fbk_t fbk = DEFAULT_FBK>
+inline tinyjambu::task<bool>
+async_decrypt(
+  const uint8_t* const key,                   // 128 -bit secret key
+  const uint8_t* const nonce,                 // 96 -bit public message nonce
+  const uint8_t* const tag,                   // 64 -bit authentication tag
+  const uint8_t* const data,                  // associated data
+  const size_t data_len,                      // associated data byte length
+  const uint8_t* const cipher,                // cipher text
+  uint8_t* const text,                        // plain text
+  const size_t ct_len,                        // cipher/ plain text byte length
+  const tinyjambu::executor_t exec = {},      // resumes suspended coroutine
+  const size_t slice = tinyjambu::SLICE_BYTES // bytes per slice
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_128;
+  return tinyjambu::async_decrypt<v, fbk>(
+    key, nonce, tag, data, data_len, cipher, text, ct_len, exec, slice);
+}
+
+}
+
+// Coroutine based TinyJambu-192 AEAD
+namespace tinyjambu_192 {
+
+// Coroutine based TinyJambu-192 Authenticated Encryption, which processes
+// associated data & plain text in slices of `slice` -bytes, suspending ( via
+// `exec` ) before each of them, so that a long message doesn't block calling
+// thread's event loop. Produces same cipher text & authentication tag as
+// `encrypt`, once returned task completes.
+//
+// Note, all buffers must stay alive until returned task completes.
+template<const fbk_t fbk = DEFAULT_FBK>
+inline tinyjambu::task<void>
+async_encrypt(
+  const uint8_t* const key,                   // 192 -bit secret key
+  const uint8_t* const nonce,                 // 96 -bit public message nonce
+  const uint8_t* const data,                  // associated data
+  const size_t data_len,                      // associated data byte length
+  const uint8_t* const text,                  // plain text
+  uint8_t* const cipher,                      // cipher text
+  const size_t ct_len,                        // plain/ cipher text byte length
+  uint8_t* const tag,                         // 64 -bit authentication tag
+  const tinyjambu::executor_t exec = {},      // resumes suspended coroutine
+  const size_t slice = tinyjambu::SLICE_BYTES // bytes per slice
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_192;
+  return tinyjambu::async_encrypt<v, fbk>(
+    key, nonce, data, data_len, text, cipher, ct_len, tag, exec, slice);
+}
+
+// Coroutine based TinyJambu-192 Verified Decryption, which processes associated
+// data & cipher text in slices of `slice` -bytes, suspending ( via `exec` )
+// before each of them. Produces same plain text & verification flag as
+// `decrypt`, once returned task completes.
+//
+// Note, all buffers must stay alive until returned task completes.
+//
+// Note, if task's result is not truth value, plain text is zeroed, so don't
+// consume it !
+template<const fbk_t fbk = DEFAULT_FBK>
+inline tinyjambu::task<bool>
+async_decrypt(
+  const uint8_t* const key,                   // 192 -bit secret key
+  const uint8_t* const nonce,                 // 96 -bit public message nonce
+  const uint8_t* const tag,                   // 64 -bit authentication tag
+  const uint8_t* const data,                  // associated data
+  const size_t data_len,                      // associated data byte length
+  const uint8_t* const cipher,                // cipher text
+  uint8_t* const text,                        // plain text
+  const size_t ct_len,                        // cipher/ plain text byte length
+  const tinyjambu::executor_t exec = {},      // resumes suspended coroutine
+  const size_t slice = tinyjambu::SLICE_BYTES // bytes per slice
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_192;
+  return tinyjambu::async_decrypt<v, fbk>(
+    key, nonce, tag, data, data_len, cipher, text, ct_len, exec, slice);
+}
+
+}
+
+// Coroutine based TinyJambu-256 AEAD
+namespace tinyjambu_256 {
+
+// Coroutine based TinyJambu-256 Authenticated Encryption, which processes
+// associated data & plain text in slices of `slice` -bytes, suspending ( via
+// `exec` ) before each of them, so that a long message doesn't block calling
+// thread's event loop. Produces same cipher text & authentication tag as
+// `encrypt`, once returned task completes.
+//
+// Note, all buffers must stay alive until returned task completes.
+template<const fbk_t fbk = DEFAULT_FBK>
+inline tinyjambu::task<void>
+async_encrypt(
+  const uint8_t* const key,                   // 256 -bit secret key
+  const uint8_t* const nonce,                 // 96 -bit public message nonce
+  const uint8_t* const data,                  // associated data
+  const size_t data_len,                      // associated data byte length
+  const uint8_t* const text,                  // plain text
+  uint8_t* const cipher,                      // cipher text
+  const size_t ct_len,                        // plain/ cipher text byte length
+  uint8_t* const tag,                         // 64 -bit authentication tag
+  const tinyjambu::executor_t exec = {},      // resumes suspended coroutine
+  const size_t slice = tinyjambu::SLICE_BYTES // bytes per slice
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_256;
+  return tinyjambu::async_encrypt<v, fbk>(
+    key, nonce, data, data_len, text, cipher, ct_len, tag, exec, slice);
+}
+
+// Coroutine based TinyJambu-256 Verified Decryption, which processes associated
+// data & cipher text in slices of `slice` -bytes, suspending ( via `exec` )
+// before each of them. Produces same plain text & verification flag as
+// `decrypt`, once returned task completes.
+//
+// Note, all buffers must stay alive until returned task completes.
+//
+// Note, if task's result is not truth value, plain text is zeroed, so don't
+// consume it !
+template<const fbk_t fbk = DEFAULT_FBK>
+inline tinyjambu::task<bool>
+async_decrypt(
+  const uint8_t* const key,                   // 256 -bit secret key
+  const uint8_t* const nonce,                 // 96 -bit public message nonce
+  const uint8_t* const tag,                   // 64 -bit authentication tag
+  const uint8_t* const data,                  // associated data
+  const size_t data_len,                      // associated data byte length
+  const uint8_t* const cipher,                // cipher text
+  uint8_t* const text,                        // plain text
+  const size_t ct_len,                        // cipher/ plain text byte length
+  const tinyjambu::executor_t exec = {},      // resumes suspended coroutine
+  const size_t slice = tinyjambu::SLICE_BYTES // bytes per slice
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_256;
+  return tinyjambu::async_decrypt<v, fbk>(
+    key, nonce, tag, data, data_len, cipher, text, ct_len, exec, slice);
+}
+
+}
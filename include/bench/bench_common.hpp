@@ -0,0 +1,16 @@
+#pragma once
+#include <cstdint>
+
+#if defined __x86_64__
+#include <x86intrin.h>
+
+// Reads CPU timestamp counter, after waiting for all earlier instructions to
+// complete, which is used for reporting cycles/ byte of benchmarked routines
+inline uint64_t
+cpu_cycles()
+{
+  _mm_lfence();
+  return __rdtsc();
+}
+
+#endif
@@ -0,0 +1,62 @@
+#pragma once
+#include "bench_common.hpp"
+#include "fixed.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// Benchmark TinyJambu-{128, 192, 256} authenticated encryption of a fixed-size
+// record, of `ad_len` -bytes associated data & `ct_len` -bytes plain text,
+// using fixed-length ( compile-time ) routine, when `fixed` is true, otherwise
+// using runtime length routine, so that both can be compared
+template<const tinyjambu::variant v,
+         const size_t ad_len,
+         const size_t ct_len,
+         const bool fixed>
+void
+tinyjambu_encrypt_fixed(benchmark::State& state)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  std::vector<uint8_t> key(klen), nonce(12), data(ad_len);
+  std::vector<uint8_t> text(ct_len), enc(ct_len), tag(8);
+
+  random_data(key.data(), klen);
+  random_data(nonce.data(), 12);
+  random_data(data.data(), ad_len);
+  random_data(text.data(), ct_len);
+
+  // hide lengths from compiler, for runtime length routine
+  size_t dt_len = ad_len, pt_len = ct_len;
+  benchmark::DoNotOptimize(dt_len);
+  benchmark::DoNotOptimize(pt_len);
+
+  for (auto _ : state) {
+    if constexpr (fixed) {
+      encrypt_fixed<v, ad_len, ct_len>(key.data(),
+                                       nonce.data(),
+                                       data.data(),
+                                       text.data(),
+                                       enc.data(),
+                                       tag.data());
+    } else {
+      uint32_t st[4]{};
+      uint32_t key_[key_word_cnt<v>()];
+
+      load_key<v>(key.data(), key_);
+
+      initialize<v>(st, key_, nonce.data());
+      process_associated_data<v>(st, key_, data.data(), dt_len);
+      process_plain_text<v>(st, key_, text.data(), enc.data(), pt_len);
+      finalize<v>(st, key_, tag.data());
+    }
+
+    benchmark::DoNotOptimize(enc.data());
+    benchmark::DoNotOptimize(tag.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(
+    static_cast<int64_t>((ad_len + ct_len) * state.iterations()));
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include "bench_common.hpp"
+#include "mb_manager.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// Benchmark TinyJambu-{128, 192, 256} authenticated encryption of 256
+// messages, each under its own secret key, where every eighth message carries
+// `long` -bytes plain text, while all others carry `short` -bytes. When `mb` is
+// true, messages are submitted to multi-buffer job manager, otherwise they're
+// encrypted using `encrypt_batch`, N messages at a time, where short messages'
+// lanes idle ( masked ), while long one is being processed. Lane occupancy of
+// job manager is reported as a counter.
+template<const tinyjambu::variant v, const bool mb>
+void
+tinyjambu_encrypt_mixed(benchmark::State& state)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t msg_cnt = 256;
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+  constexpr size_t dt_len = 16;
+
+  const size_t short_len = state.range(0);
+  const size_t long_len = state.range(1);
+
+  std::vector<std::vector<uint8_t>> text(msg_cnt), enc(msg_cnt);
+  std::vector<uint8_t> key(msg_cnt * klen), nonce(msg_cnt * 12);
+  std::vector<uint8_t> data(msg_cnt * dt_len), tag(msg_cnt * 8);
+
+  random_data(key.data(), key.size());
+  random_data(nonce.data(), nonce.size());
+  random_data(data.data(), data.size());
+
+  const uint8_t* key_[msg_cnt];
+  const uint8_t* nonce_[msg_cnt];
+  const uint8_t* data_[msg_cnt];
+  const uint8_t* text_[msg_cnt];
+  uint8_t* enc_[msg_cnt];
+  uint8_t* tag_[msg_cnt];
+  size_t dt_len_[msg_cnt];
+  size_t ct_len_[msg_cnt];
+
+  std::vector<mb::job_t> jobs(msg_cnt);
+  size_t bytes = 0;
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    const size_t ct_len = (i % 8 == 0) ? long_len : short_len;
+
+    text[i].resize(ct_len);
+    enc[i].resize(ct_len);
+    random_data(text[i].data(), ct_len);
+
+    key_[i] = key.data() + i * klen;
+    nonce_[i] = nonce.data() + i * 12;
+    data_[i] = data.data() + i * dt_len;
+    text_[i] = text[i].data();
+    enc_[i] = enc[i].data();
+    tag_[i] = tag.data() + i * 8;
+    dt_len_[i] = dt_len;
+    ct_len_[i] = ct_len;
+
+    jobs[i] = mb::job_t{ direction_t::encrypt,
+                         key_[i],
+                         nonce_[i],
+                         { data_[i], dt_len },
+                         text[i],
+                         enc[i],
+                         tag_[i],
+                         mb::status_t::pending };
+    bytes += dt_len + ct_len;
+  }
+
+  mb::manager<v> m;
+
+  for (auto _ : state) {
+    if constexpr (mb) {
+      for (size_t i = 0; i < msg_cnt; i++) {
+        benchmark::DoNotOptimize(m.submit(&jobs[i]));
+      }
+      while (m.flush() != nullptr) {
+      }
+    } else {
+      encrypt_batch<v>(key_,
+                       nonce_,
+                       data_,
+                       dt_len_,
+                       text_,
+                       enc_,
+                       ct_len_,
+                       tag_,
+                       msg_cnt);
+    }
+
+    benchmark::DoNotOptimize(enc_);
+    benchmark::DoNotOptimize(tag.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(bytes * state.iterations()));
+  if constexpr (mb) {
+    state.counters["occupancy"] = m.occupancy();
+  }
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "bench_common.hpp"
+#include "parallel.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// Benchmark multi-threaded TinyJambu-{128, 192, 256} authenticated encryption,
+// spreading 1024 independent messages over a pool of N workers, so that
+// throughput can be compared across N, to see how it scales with # -of cores
+template<const tinyjambu::variant v>
+void
+tinyjambu_encrypt_parallel(benchmark::State& state)
+{
+  using namespace tinyjambu;
+  using parallel::job_t;
+
+  constexpr size_t msg_cnt = 1024;
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  const size_t ct_len = state.range(0);
+  const size_t dt_len = state.range(1);
+  const size_t n = state.range(2);
+
+  std::vector<uint8_t> key(klen), nonce(12), data(dt_len);
+  std::vector<uint8_t> text(msg_cnt * ct_len), enc(msg_cnt * ct_len);
+  std::vector<uint8_t> tag(msg_cnt * 8);
+  std::vector<job_t> jobs(msg_cnt);
+
+  random_data(key.data(), klen);
+  random_data(nonce.data(), 12);
+  random_data(data.data(), dt_len);
+  random_data(text.data(), text.size());
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    const size_t off = i * ct_len;
+
+    jobs[i] = job_t{ key.data(),
+                     nonce.data(),
+                     data,
+                     { text.data() + off, ct_len },
+                     { enc.data() + off, ct_len },
+                     tag.data() + i * 8 };
+  }
+
+  parallel::pool pool{ n };
+
+  for (auto _ : state) {
+    pool.encrypt<v>(jobs);
+
+    benchmark::DoNotOptimize(enc.data());
+    benchmark::DoNotOptimize(tag.data());
+    benchmark::ClobberMemory();
+  }
+
+  const size_t per_itr_data = msg_cnt * (dt_len + ct_len);
+  const size_t total_data = per_itr_data * state.iterations();
+
+  state.SetBytesProcessed(static_cast<int64_t>(total_data));
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "bench_common.hpp"
+#include "tinyjambu.hpp"
+#include <benchmark/benchmark.h>
+
+// Benchmark TinyJambu-{128, 192, 256} permutation, updating 128 -bit state
+// `rounds` -many times, computing `fbk` feedback bits per iteration, where
+// `rounds` is either 640 ( as used for nonce setup & data absorption ) or
+// 1024/ 1152/ 1280 ( as used for key setup & finalization )
+template<const tinyjambu::variant v, const size_t rounds, const fbk_t fbk>
+void
+tinyjambu_permute(benchmark::State& state)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t kwords = key_word_cnt<v>();
+
+  uint32_t st[4];
+  uint32_t key[kwords];
+
+  random_data(reinterpret_cast<uint8_t*>(st), sizeof(st));
+  random_data(reinterpret_cast<uint8_t*>(key), sizeof(key));
+
+#if defined __x86_64__
+  const uint64_t start = cpu_cycles();
+#endif
+
+  for (auto _ : state) {
+    permute<v, rounds, fbk>(st, key);
+
+    benchmark::DoNotOptimize(st);
+    benchmark::DoNotOptimize(key);
+    benchmark::ClobberMemory();
+  }
+
+#if defined __x86_64__
+  const uint64_t end = cpu_cycles();
+#endif
+
+  const size_t total_rounds = rounds * state.iterations();
+
+  state.SetItemsProcessed(static_cast<int64_t>(total_rounds));
+
+#if defined __x86_64__
+  const double cycles = static_cast<double>(end - start);
+  state.counters["cycles/ round"] = cycles / static_cast<double>(total_rounds);
+#endif
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "bench_common.hpp"
+#include "pipeline.hpp"
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// Benchmark lock-free TinyJambu-{128, 192, 256} AEAD pipeline stage, with N
+// workers, where a separate producer thread pushes 4096 small messages (
+// under same key context ), while calling thread consumes sealed messages, in
+// order. Reported messages/ second include cost of handing each message off
+// twice ( producer -> worker -> consumer ).
+template<const tinyjambu::variant v>
+void
+tinyjambu_encrypt_pipeline(benchmark::State& state)
+{
+  using namespace tinyjambu;
+  using job_t = pipeline::job_t<v>;
+
+  constexpr size_t msg_cnt = 4096;
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  const size_t ct_len = state.range(0);
+  const size_t dt_len = state.range(1);
+  const size_t n = state.range(2);
+
+  std::vector<uint8_t> key(klen), nonce(12), data(dt_len);
+  std::vector<uint8_t> text(msg_cnt * ct_len), enc(msg_cnt * ct_len);
+
+  random_data(key.data(), klen);
+  random_data(nonce.data(), 12);
+  random_data(data.data(), dt_len);
+  random_data(text.data(), text.size());
+
+  const key_context<v> ctx{ key.data() };
+  pipeline::stage<v> stage{ n };
+
+  for (auto _ : state) {
+    std::thread producer{ [&] {
+      job_t j{};
+      j.dir = direction_t::encrypt;
+      j.ctx = &ctx;
+      std::memcpy(j.nonce, nonce.data(), 12);
+      j.data = data;
+
+      for (size_t i = 0; i < msg_cnt; i++) {
+        j.in = { text.data() + i * ct_len, ct_len };
+        j.out = { enc.data() + i * ct_len, ct_len };
+
+        while (!stage.try_push(j)) {
+          std::this_thread::yield();
+        }
+      }
+    } };
+
+    job_t j{};
+    for (size_t i = 0; i < msg_cnt; i++) {
+      while (!stage.try_pop(j)) {
+        std::this_thread::yield();
+      }
+      benchmark::DoNotOptimize(j.tag);
+    }
+
+    producer.join();
+
+    benchmark::DoNotOptimize(enc.data());
+    benchmark::ClobberMemory();
+  }
+
+  const size_t per_itr_data = msg_cnt * (dt_len + ct_len);
+
+  state.SetBytesProcessed(
+    static_cast<int64_t>(per_itr_data * state.iterations()));
+  state.SetItemsProcessed(static_cast<int64_t>(msg_cnt * state.iterations()));
+}
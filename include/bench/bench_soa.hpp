@@ -0,0 +1,73 @@
+#pragma once
+#include "bench_common.hpp"
+#include "tinyjambu_batch.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// Benchmark structure-of-arrays TinyJambu-{128, 192, 256} authenticated
+// encryption of 1024 fixed-size records under same secret key, when `soa` is
+// true, otherwise encrypting same records by calling one-shot `encrypt` on
+// each of them, so that both can be compared
+template<const tinyjambu::variant v, const bool soa>
+void
+tinyjambu_encrypt_records(benchmark::State& state)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t msg_cnt = 1024;
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  const size_t ct_len = state.range(0);
+  const size_t dt_len = state.range(1);
+
+  std::vector<uint8_t> key(klen), nonce(msg_cnt * 12);
+  std::vector<uint8_t> data(msg_cnt * dt_len);
+  std::vector<uint8_t> text(msg_cnt * ct_len), enc(msg_cnt * ct_len);
+  std::vector<uint8_t> tag(msg_cnt * 8);
+
+  random_data(key.data(), klen);
+  random_data(nonce.data(), nonce.size());
+  random_data(data.data(), data.size());
+  random_data(text.data(), text.size());
+
+  for (auto _ : state) {
+    if constexpr (soa) {
+      tinyjambu::encrypt_soa<v>(key.data(),
+                                nonce.data(),
+                                data.data(),
+                                dt_len,
+                                dt_len,
+                                text.data(),
+                                enc.data(),
+                                ct_len,
+                                ct_len,
+                                tag.data(),
+                                msg_cnt);
+    } else {
+      for (size_t i = 0; i < msg_cnt; i++) {
+        uint32_t st[4]{};
+        uint32_t key_[key_word_cnt<v>()];
+
+        load_key<v>(key.data(), key_);
+        initialize<v>(st, key_, nonce.data() + i * 12);
+        process_associated_data<v>(
+          st, key_, data.data() + i * dt_len, dt_len);
+        process_plain_text<v>(st,
+                              key_,
+                              text.data() + i * ct_len,
+                              enc.data() + i * ct_len,
+                              ct_len);
+        finalize<v>(st, key_, tag.data() + i * 8);
+      }
+    }
+
+    benchmark::DoNotOptimize(enc.data());
+    benchmark::DoNotOptimize(tag.data());
+    benchmark::ClobberMemory();
+  }
+
+  const size_t per_itr_data = msg_cnt * (dt_len + ct_len);
+  const size_t total_data = per_itr_data * state.iterations();
+
+  state.SetBytesProcessed(static_cast<int64_t>(total_data));
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "bench_common.hpp"
+#include "key_context.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// Secret key used for benchmarking compile-time key contexts
+template<const tinyjambu::variant v>
+constexpr tinyjambu::key_bytes_t<v> BENCH_KEY = [] {
+  tinyjambu::key_bytes_t<v> key{};
+  for (size_t i = 0; i < key.size(); i++) {
+    key[i] = static_cast<uint8_t>(i * 0x9d + 0x3b);
+  }
+  return key;
+}();
+
+// Benchmark TinyJambu-{128, 192, 256} authenticated encryption, under secret
+// key known at compile-time, using compile-time key context, when `fixed` is
+// true, otherwise using runtime key context, prepared from same key, so that
+// both can be compared. Both compute all feedback bits without loop.
+template<const tinyjambu::variant v, const bool fixed>
+void
+tinyjambu_encrypt_static_key(benchmark::State& state)
+{
+  using namespace tinyjambu;
+
+  const size_t ct_len = state.range(0);
+  const size_t dt_len = state.range(1);
+
+  std::vector<uint8_t> nonce(12), data(dt_len);
+  std::vector<uint8_t> text(ct_len), enc(ct_len), tag(8);
+
+  random_data(nonce.data(), 12);
+  random_data(data.data(), dt_len);
+  random_data(text.data(), ct_len);
+
+  const key_context<v, fbk_t::fbk_all> ctx{ BENCH_KEY<v>.data() };
+  using sctx = static_key_context<v, BENCH_KEY<v>>;
+
+  for (auto _ : state) {
+    if constexpr (fixed) {
+      sctx::encrypt(nonce.data(),
+                    data.data(),
+                    dt_len,
+                    text.data(),
+                    enc.data(),
+                    ct_len,
+                    tag.data());
+    } else {
+      ctx.encrypt(nonce.data(),
+                  data.data(),
+                  dt_len,
+                  text.data(),
+                  enc.data(),
+                  ct_len,
+                  tag.data());
+    }
+
+    benchmark::DoNotOptimize(enc.data());
+    benchmark::DoNotOptimize(tag.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(
+    static_cast<int64_t>((dt_len + ct_len) * state.iterations()));
+}
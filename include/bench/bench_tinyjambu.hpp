@@ -1,5 +1,12 @@
 #pragma once
 
+#include "bench_parallel.hpp"
+#include "bench_pipeline.hpp"
+#include "bench_fixed.hpp"
+#include "bench_mb.hpp"
+#include "bench_permute.hpp"
+#include "bench_soa.hpp"
+#include "bench_static_key.hpp"
 #include "bench_tinyjambu_128.hpp"
 #include "bench_tinyjambu_192.hpp"
 #include "bench_tinyjambu_256.hpp"
@@ -1,10 +1,13 @@
 #pragma once
+#include "bench_common.hpp"
 #include "tinyjambu_128.hpp"
 #include <benchmark/benchmark.h>
 #include <cassert>
 #include <string.h>
 
-// Benchmark TinyJambu-128 authenticated encryption routine
+// Benchmark TinyJambu-128 authenticated encryption routine, computing `fbk`
+// feedback bits per iteration of underlying permutation
+template<const fbk_t fbk = DEFAULT_FBK>
 void
 tinyjambu_128_encrypt(benchmark::State& state)
 {
@@ -29,8 +32,13 @@ tinyjambu_128_encrypt(benchmark::State& state)
   // random public message nonce ( = 96 -bit )
   random_data(nonce, 12);
 
+#if defined __x86_64__
+  const uint64_t start = cpu_cycles();
+#endif
+
   for (auto _ : state) {
-    tinyjambu_128::encrypt(key, nonce, data, dt_len, text, enc, ct_len, tag);
+    tinyjambu_128::encrypt<fbk>(
+      key, nonce, data, dt_len, text, enc, ct_len, tag);
 
     benchmark::DoNotOptimize(key);
     benchmark::DoNotOptimize(nonce);
@@ -41,6 +49,10 @@ tinyjambu_128_encrypt(benchmark::State& state)
     benchmark::ClobberMemory();
   }
 
+#if defined __x86_64__
+  const uint64_t end = cpu_cycles();
+#endif
+
   bool flg = false;
   flg = tinyjambu_128::decrypt(key, nonce, tag, data, dt_len, enc, dec, ct_len);
   assert(flg);
@@ -50,6 +62,11 @@ tinyjambu_128_encrypt(benchmark::State& state)
 
   state.SetBytesProcessed(static_cast<int64_t>(total_data));
 
+#if defined __x86_64__
+  const double cycles = static_cast<double>(end - start);
+  state.counters["cycles/ byte"] = cycles / static_cast<double>(total_data);
+#endif
+
   // deallocate all resources
   free(text);
   free(enc);
@@ -60,7 +77,9 @@ tinyjambu_128_encrypt(benchmark::State& state)
   free(tag);
 }
 
-// Benchmark TinyJambu-128 verified decryption routine
+// Benchmark TinyJambu-128 verified decryption routine, computing `fbk`
+// feedback bits per iteration of underlying permutation
+template<const fbk_t fbk = DEFAULT_FBK>
 void
 tinyjambu_128_decrypt(benchmark::State& state)
 {
@@ -85,14 +104,19 @@ tinyjambu_128_decrypt(benchmark::State& state)
   // random public message nonce ( = 96 -bit )
   random_data(nonce, 12);
 
-  tinyjambu_128::encrypt(key, nonce, data, dt_len, text, enc, ct_len, tag);
+  tinyjambu_128::encrypt<fbk>(
+    key, nonce, data, dt_len, text, enc, ct_len, tag);
+
+#if defined __x86_64__
+  const uint64_t start = cpu_cycles();
+#endif
 
   for (auto _ : state) {
     using namespace tinyjambu_128;
     using namespace benchmark;
 
     bool flg = false;
-    flg = decrypt(key, nonce, tag, data, dt_len, enc, dec, ct_len);
+    flg = decrypt<fbk>(key, nonce, tag, data, dt_len, enc, dec, ct_len);
     assert(flg);
 
     DoNotOptimize(key);
@@ -104,11 +128,20 @@ tinyjambu_128_decrypt(benchmark::State& state)
     benchmark::ClobberMemory();
   }
 
+#if defined __x86_64__
+  const uint64_t end = cpu_cycles();
+#endif
+
   const size_t per_itr_data = dt_len + ct_len;
   const size_t total_data = per_itr_data * state.iterations();
 
   state.SetBytesProcessed(static_cast<int64_t>(total_data));
 
+#if defined __x86_64__
+  const double cycles = static_cast<double>(end - start);
+  state.counters["cycles/ byte"] = cycles / static_cast<double>(total_data);
+#endif
+
   // deallocate all resources
   free(text);
   free(enc);
@@ -118,3 +151,275 @@ tinyjambu_128_decrypt(benchmark::State& state)
   free(nonce);
   free(tag);
 }
+
+// Benchmark verify-only TinyJambu-128 decryption routine, which checks
+// authenticity of cipher text, without writing any plain text
+template<const fbk_t fbk = DEFAULT_FBK>
+void
+tinyjambu_128_verify(benchmark::State& state)
+{
+  const size_t ct_len = state.range(0);
+  const size_t dt_len = state.range(1);
+
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(dt_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(16));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(12));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(8));
+
+  // random plain text bytes
+  random_data(text, ct_len);
+  // random associated data bytes
+  random_data(data, dt_len);
+  // random secret key ( = 128 -bit )
+  random_data(key, 16);
+  // random public message nonce ( = 96 -bit )
+  random_data(nonce, 12);
+
+  tinyjambu_128::encrypt<fbk>(
+    key, nonce, data, dt_len, text, enc, ct_len, tag);
+
+#if defined __x86_64__
+  const uint64_t start = cpu_cycles();
+#endif
+
+  for (auto _ : state) {
+    using namespace tinyjambu_128;
+    using namespace benchmark;
+
+    bool flg = false;
+    flg = verify<fbk>(key, nonce, tag, data, dt_len, enc, ct_len);
+    assert(flg);
+
+    DoNotOptimize(flg);
+    DoNotOptimize(key);
+    DoNotOptimize(nonce);
+    DoNotOptimize(tag);
+    DoNotOptimize(data);
+    DoNotOptimize(enc);
+    benchmark::ClobberMemory();
+  }
+
+#if defined __x86_64__
+  const uint64_t end = cpu_cycles();
+#endif
+
+  const size_t per_itr_data = dt_len + ct_len;
+  const size_t total_data = per_itr_data * state.iterations();
+
+  state.SetBytesProcessed(static_cast<int64_t>(total_data));
+
+#if defined __x86_64__
+  const double cycles = static_cast<double>(end - start);
+  state.counters["cycles/ byte"] = cycles / static_cast<double>(total_data);
+#endif
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark batched TinyJambu-128 authenticated encryption routine, which
+// encrypts `tinyjambu::LANE_CNT` -many independent messages in lockstep
+void
+tinyjambu_128_encrypt_batch(benchmark::State& state)
+{
+  const size_t ct_len = state.range(0);
+  const size_t dt_len = state.range(1);
+  constexpr size_t N = tinyjambu::LANE_CNT;
+
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(N * ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(N * ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(N * dt_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(N * 16));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(N * 12));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(N * 8));
+
+  // random plain text bytes
+  random_data(text, N * ct_len);
+  // random associated data bytes
+  random_data(data, N * dt_len);
+  // random secret keys ( = 128 -bit each )
+  random_data(key, N * 16);
+  // random public message nonces ( = 96 -bit each )
+  random_data(nonce, N * 12);
+
+  const uint8_t* key_[N];
+  const uint8_t* nonce_[N];
+  const uint8_t* data_[N];
+  const uint8_t* text_[N];
+  uint8_t* enc_[N];
+  uint8_t* tag_[N];
+  size_t dt_len_[N];
+  size_t ct_len_[N];
+
+  for (size_t i = 0; i < N; i++) {
+    key_[i] = key + i * 16;
+    nonce_[i] = nonce + i * 12;
+    data_[i] = data + i * dt_len;
+    text_[i] = text + i * ct_len;
+    enc_[i] = enc + i * ct_len;
+    tag_[i] = tag + i * 8;
+    dt_len_[i] = dt_len;
+    ct_len_[i] = ct_len;
+  }
+
+  for (auto _ : state) {
+    tinyjambu_128::encrypt_batch(
+      key_, nonce_, data_, dt_len_, text_, enc_, ct_len_, tag_, N);
+
+    benchmark::DoNotOptimize(key);
+    benchmark::DoNotOptimize(nonce);
+    benchmark::DoNotOptimize(data);
+    benchmark::DoNotOptimize(text);
+    benchmark::DoNotOptimize(enc);
+    benchmark::DoNotOptimize(tag);
+    benchmark::ClobberMemory();
+  }
+
+  const size_t per_itr_data = N * (dt_len + ct_len);
+  const size_t total_data = per_itr_data * state.iterations();
+
+  state.SetBytesProcessed(static_cast<int64_t>(total_data));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark interleaved TinyJambu-128 authenticated encryption routine, which
+// encrypts N -many independent messages in same loop body, using general
+// purpose registers
+template<const size_t N>
+void
+tinyjambu_128_encrypt_interleaved(benchmark::State& state)
+{
+  const size_t ct_len = state.range(0);
+  const size_t dt_len = state.range(1);
+
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(N * ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(N * ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(N * dt_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(N * 16));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(N * 12));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(N * 8));
+
+  // random plain text bytes
+  random_data(text, N * ct_len);
+  // random associated data bytes
+  random_data(data, N * dt_len);
+  // random secret keys ( = 128 -bit each )
+  random_data(key, N * 16);
+  // random public message nonces ( = 96 -bit each )
+  random_data(nonce, N * 12);
+
+  const uint8_t* key_[N];
+  const uint8_t* nonce_[N];
+  const uint8_t* data_[N];
+  const uint8_t* text_[N];
+  uint8_t* enc_[N];
+  uint8_t* tag_[N];
+  size_t dt_len_[N];
+  size_t ct_len_[N];
+
+  for (size_t i = 0; i < N; i++) {
+    key_[i] = key + i * 16;
+    nonce_[i] = nonce + i * 12;
+    data_[i] = data + i * dt_len;
+    text_[i] = text + i * ct_len;
+    enc_[i] = enc + i * ct_len;
+    tag_[i] = tag + i * 8;
+    dt_len_[i] = dt_len;
+    ct_len_[i] = ct_len;
+  }
+
+  for (auto _ : state) {
+    tinyjambu_128::encrypt_interleaved<N>(
+      key_, nonce_, data_, dt_len_, text_, enc_, ct_len_, tag_, N);
+
+    benchmark::DoNotOptimize(key);
+    benchmark::DoNotOptimize(nonce);
+    benchmark::DoNotOptimize(data);
+    benchmark::DoNotOptimize(text);
+    benchmark::DoNotOptimize(enc);
+    benchmark::DoNotOptimize(tag);
+    benchmark::ClobberMemory();
+  }
+
+  const size_t per_itr_data = N * (dt_len + ct_len);
+  const size_t total_data = per_itr_data * state.iterations();
+
+  state.SetBytesProcessed(static_cast<int64_t>(total_data));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
+
+// Benchmark TinyJambu-128 authenticated encryption routine, when secret key
+// setup is done only once, using reusable key context
+void
+tinyjambu_128_encrypt_ctx(benchmark::State& state)
+{
+  const size_t ct_len = state.range(0);
+  const size_t dt_len = state.range(1);
+
+  // acquire memory resources
+  uint8_t* text = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* enc = static_cast<uint8_t*>(malloc(ct_len));
+  uint8_t* data = static_cast<uint8_t*>(malloc(dt_len));
+  uint8_t* key = static_cast<uint8_t*>(malloc(16));
+  uint8_t* nonce = static_cast<uint8_t*>(malloc(12));
+  uint8_t* tag = static_cast<uint8_t*>(malloc(8));
+
+  // random plain text bytes
+  random_data(text, ct_len);
+  // random associated data bytes
+  random_data(data, dt_len);
+  // random secret key ( = 128 -bit )
+  random_data(key, 16);
+  // random public message nonce ( = 96 -bit )
+  random_data(nonce, 12);
+
+  const tinyjambu_128::key_context ctx{ key };
+
+  for (auto _ : state) {
+    ctx.encrypt(nonce, data, dt_len, text, enc, ct_len, tag);
+
+    benchmark::DoNotOptimize(nonce);
+    benchmark::DoNotOptimize(data);
+    benchmark::DoNotOptimize(text);
+    benchmark::DoNotOptimize(enc);
+    benchmark::DoNotOptimize(tag);
+    benchmark::ClobberMemory();
+  }
+
+  const size_t per_itr_data = dt_len + ct_len;
+  const size_t total_data = per_itr_data * state.iterations();
+
+  state.SetBytesProcessed(static_cast<int64_t>(total_data));
+
+  // deallocate all resources
+  free(text);
+  free(enc);
+  free(data);
+  free(key);
+  free(nonce);
+  free(tag);
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include "tinyjambu.hpp"
+#include <array>
+
+// Compile-time sealing of embedded blobs ( say firmware configuration or a
+// provisioning secret ), using TinyJambu-{128, 192, 256} AEAD, where whole
+// encryption path is evaluated by compiler, so that only sealed bytes ( i.e.
+// cipher text || tag ) end up in binary, while runtime pays only for opening
+namespace tinyjambu::blob {
+
+// Byte length of {128, 192, 256} -bit secret key
+template<const variant v>
+constexpr size_t KEY_LEN = key_word_cnt<v>() << 2;
+
+// Converts string literal to byte array, dropping terminating null byte
+template<const size_t N>
+consteval std::array<uint8_t, N - 1>
+bytes(const char (&str)[N])
+{
+  std::array<uint8_t, N - 1> res{};
+  for (size_t i = 0; i < N - 1; i++) {
+    res[i] = static_cast<uint8_t>(str[i]);
+  }
+  return res;
+}
+
+// Authenticated encryption of N -bytes plain text & M -bytes associated data,
+// using TinyJambu-{128, 192, 256}, evaluated at compile-time, returning ( N +
+// 8 ) -bytes sealed blob, holding cipher text, followed by authentication tag.
+// Produces same bytes as `tinyjambu_{128, 192, 256}::seal`.
+template<const variant v,
+         const size_t N,
+         const size_t M = 0,
+         const fbk_t fbk = DEFAULT_FBK>
+consteval std::array<uint8_t, N + 8>
+seal(const std::array<uint8_t, KEY_LEN<v>>& key,
+     const std::array<uint8_t, 12>& nonce,
+     const std::array<uint8_t, N>& text,
+     const std::array<uint8_t, M>& data = {})
+{
+  std::array<uint8_t, N + 8> sealed{};
+
+  uint32_t state[4]{};
+  uint32_t key_[key_word_cnt<v>()]{};
+
+  load_key<v>(key.data(), key_);
+
+  initialize<v, fbk>(state, key_, nonce.data());
+  process_associated_data<v, fbk>(state, key_, data.data(), M);
+  process_plain_text<v, fbk>(state, key_, text.data(), sealed.data(), N);
+  finalize<v, fbk>(state, key_, sealed.data() + N);
+
+  return sealed;
+}
+
+// Verified decryption of ( N + 8 ) -bytes sealed blob ( see `seal` ) & M
+// -bytes associated data, using TinyJambu-{128, 192, 256}, writing N -bytes
+// plain text & returning boolean verification flag. It can be invoked both at
+// runtime & during constant evaluation.
+//
+// Note, if returned boolean verification status is not truth value, plain text
+// is zeroed, so don't consume it !
+template<const variant v,
+         const size_t N,
+         const size_t M = 0,
+         const fbk_t fbk = DEFAULT_FBK>
+constexpr bool
+open(const uint8_t* const __restrict key,   // {128, 192, 256} -bit secret key
+     const uint8_t* const __restrict nonce, // 96 -bit public message nonce
+     const std::array<uint8_t, N + 8>& sealed,
+     std::array<uint8_t, N>& text,
+     const std::array<uint8_t, M>& data = {})
+{
+  uint32_t state[4]{};
+  uint32_t key_[key_word_cnt<v>()]{};
+  uint8_t tag[8]{};
+
+  load_key<v>(key, key_);
+
+  initialize<v, fbk>(state, key_, nonce);
+  process_associated_data<v, fbk>(state, key_, data.data(), M);
+  process_cipher_text<v, fbk>(state, key_, sealed.data(), text.data(), N);
+  finalize<v, fbk>(state, key_, tag);
+
+  const bool flag = mismatch(sealed.data() + N, tag);
+
+  // prevent release of unverified plain text ( RUP )
+  wipe(text.data(), flag * N);
+  return !flag;
+}
+
+}
@@ -0,0 +1,320 @@
+#pragma once
+#include "parallel.hpp"
+#include <cstring>
+#include <limits>
+
+// Chunked ( STREAM-style ) TinyJambu-{128, 192, 256} AEAD for large objects,
+// which splits plain text into fixed-size chunks & seals each of them as an
+// independent TinyJambu message, so that chunks can be encrypted/ verified in
+// parallel, while truncation, reordering & extension are still detected.
+//
+// Nonce of i-th chunk ( out of n ) is derived from 7 -bytes nonce prefix as
+//
+// prefix || BE32(i) || (i == n - 1 ? 0x01 : 0x00)
+//
+// so chunk index & last chunk flag are authenticated alongside each chunk,
+// while associated data is bound to every chunk. Encrypted object is
+// concatenation of sealed chunks ( i.e. cipher text || 8 -bytes tag, see
+// `tinyjambu_{128, 192, 256}::seal` ), where all but last chunk carry exactly
+// `chunk_len` -bytes of plain text & last one carries 1 to `chunk_len` -bytes
+// ( or 0 -bytes, for empty object, which is still sealed as single chunk ).
+//
+// Note, a nonce prefix must never be reused under same secret key.
+namespace tinyjambu::chunked {
+
+// Byte length of nonce prefix, from which all chunk nonces are derived
+constexpr size_t PREFIX_LEN = 7;
+
+// Byte length of authentication tag, appended to each chunk
+constexpr size_t TAG_LEN = 8;
+
+// # -of chunks, N -bytes plain text is split into, using chunks of `chunk_len`
+// ( > 0 ) -bytes
+constexpr size_t
+chunk_cnt(const size_t len, const size_t chunk_len)
+{
+  return len == 0 ? 1 : (len + chunk_len - 1) / chunk_len;
+}
+
+// Byte length of encrypted object, for N -bytes plain text, using chunks of
+// `chunk_len` ( > 0 ) -bytes
+constexpr size_t
+sealed_len(const size_t len, const size_t chunk_len)
+{
+  return len + chunk_cnt(len, chunk_len) * TAG_LEN;
+}
+
+// Byte length of plain text, carried by N -bytes encrypted object, which was
+// produced using chunks of `chunk_len` ( > 0 ) -bytes. Returns false, if no
+// encrypted object can be of N -bytes.
+constexpr bool
+opened_len(const size_t len, const size_t chunk_len, size_t& text_len)
+{
+  const size_t full = chunk_len + TAG_LEN;
+
+  if (len < TAG_LEN) {
+    return false;
+  }
+
+  const size_t n = (len + full - 1) / full;
+  const size_t last = len - (n - 1) * full;
+
+  // last chunk must carry a tag & unless it's the only one, some plain text
+  if (last < TAG_LEN || (n > 1 && last == TAG_LEN)) {
+    return false;
+  }
+  if (n - 1 > std::numeric_limits<uint32_t>::max()) {
+    return false;
+  }
+
+  text_len = len - n * TAG_LEN;
+  return true;
+}
+
+// Derives 12 -bytes nonce of i-th chunk, from 7 -bytes nonce prefix
+inline void
+chunk_nonce(const uint8_t* const __restrict prefix, // 7 -bytes nonce prefix
+            const uint32_t idx,                     // chunk index
+            const bool last,                        // is it last chunk ?
+            uint8_t* const __restrict nonce         // 12 -bytes chunk nonce
+)
+{
+  std::memcpy(nonce, prefix, PREFIX_LEN);
+
+  nonce[7] = static_cast<uint8_t>(idx >> 24);
+  nonce[8] = static_cast<uint8_t>(idx >> 16);
+  nonce[9] = static_cast<uint8_t>(idx >> 8);
+  nonce[10] = static_cast<uint8_t>(idx);
+  nonce[11] = static_cast<uint8_t>(last);
+}
+
+// Authenticated encryption of a segment of plain text, which makes up chunks
+// [first, first + n) of an object, where n = `chunk_cnt(N, chunk_len)`,
+// writing `sealed_len(N, chunk_len)` -bytes to `out`. When `last` is set,
+// segment's final chunk is object's last chunk, otherwise N must be a non-zero
+// multiple of `chunk_len`. This allows encrypting an object of unknown length (
+// say read from a pipe ), one segment at a time, while producing same output
+// as `encrypt`. When `pool` is given, chunks are encrypted in parallel, on its
+// workers, otherwise they're encrypted one after another, on calling thread.
+// Returns false, without writing anything, if segment's last chunk index
+// doesn't fit in 32 -bit, because chunk nonces would then repeat, or if it's
+// a segment `decrypt_chunks` would reject ( i.e. non-last segment, whose
+// length isn't a non-zero multiple of `chunk_len`, or empty last segment, not
+// starting at chunk 0 ).
+//
+// Note, as only first chunk of an object may be empty, a caller, streaming
+// plain text of unknown length, must hold back ( at least ) one final chunk,
+// until it hits end of input, so that last segment is never empty, unless
+// whole object is ( see `run_streamed` in tjcrypt ).
+//
+// Note, `text` & `out` must not overlap.
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+inline bool
+encrypt_chunks(
+  const uint8_t* const __restrict key,    // secret key
+  const uint8_t* const __restrict prefix, // 7 -bytes nonce prefix
+  const uint8_t* const __restrict data,   // associated data
+  const size_t data_len,                  // associated data byte length
+  const uint64_t first,                   // index of segment's first chunk
+  const uint8_t* const __restrict text,   // plain text segment
+  const size_t len,                       // plain text segment byte length
+  const size_t chunk_len,                 // plain text bytes per chunk
+  const bool last,                        // is it object's last segment ?
+  uint8_t* const __restrict out,          // encrypted segment
+  parallel::pool* const pool = nullptr    // optional worker pool
+)
+{
+  // same segment shape, as what `decrypt_chunks` accepts
+  const bool partial = len == 0 || len % chunk_len != 0;
+  if ((!last && partial) || (first > 0 && len == 0)) {
+    return false;
+  }
+
+  const size_t n = chunk_cnt(len, chunk_len);
+  if (first + n - 1 > std::numeric_limits<uint32_t>::max()) {
+    return false;
+  }
+
+  const std::span<const uint8_t> ad{ data, data_len };
+
+  // i-th chunk, as an independent job, whose nonce is written to `nonce`
+  auto job = [&](const size_t i, uint8_t* const nonce) {
+    const size_t off = i * chunk_len;
+    const size_t clen = std::min(chunk_len, len - off);
+    const uint32_t idx = static_cast<uint32_t>(first + i);
+    uint8_t* const sealed = out + i * (chunk_len + TAG_LEN);
+
+    chunk_nonce(prefix, idx, last && i == n - 1, nonce);
+
+    return parallel::job_t{
+      key, nonce, ad, { text + off, clen }, { sealed, clen }, sealed + clen
+    };
+  };
+
+  if (pool == nullptr) {
+    uint8_t nonce[12];
+
+    for (size_t i = 0; i < n; i++) {
+      parallel::encrypt_job<v, fbk>(job(i, nonce));
+    }
+  } else {
+    std::vector<uint8_t> nonces(n * 12);
+    std::vector<parallel::job_t> jobs(n);
+
+    for (size_t i = 0; i < n; i++) {
+      jobs[i] = job(i, nonces.data() + i * 12);
+    }
+
+    pool->encrypt<v, fbk>(jobs);
+  }
+
+  return true;
+}
+
+// Verified decryption of a segment of encrypted object, which makes up chunks
+// [first, first + n) of it ( see `encrypt_chunks` ), writing plain text ( of
+// byte length as computed by `opened_len` ) to `text`. When `last` is set,
+// segment's final chunk must be object's last chunk, otherwise N must be a
+// non-zero multiple of `chunk_len + 8`. Returns truth value only if N is a
+// valid segment length & all chunks are authentic, at their expected position.
+// When `pool` is given, chunks are decrypted in parallel, on its workers,
+// otherwise they're decrypted one after another, on calling thread.
+//
+// Note, `in` & `text` must not overlap.
+//
+// Note, if returned boolean verification status is not truth value, whole
+// plain text segment is zeroed, so don't consume it !
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+inline bool
+decrypt_chunks(
+  const uint8_t* const __restrict key,    // secret key
+  const uint8_t* const __restrict prefix, // 7 -bytes nonce prefix
+  const uint8_t* const __restrict data,   // associated data
+  const size_t data_len,                  // associated data byte length
+  const uint64_t first,                   // index of segment's first chunk
+  const uint8_t* const __restrict in,     // encrypted segment
+  const size_t len,                       // encrypted segment byte length
+  const size_t chunk_len,                 // plain text bytes per chunk
+  const bool last,                        // is it object's last segment ?
+  uint8_t* const __restrict text,         // plain text segment
+  parallel::pool* const pool = nullptr    // optional worker pool
+)
+{
+  const size_t full = chunk_len + TAG_LEN;
+
+  size_t text_len = 0;
+  if (!opened_len(len, chunk_len, text_len)) {
+    return false;
+  }
+
+  // only first chunk of an object may be empty & only if it's also last one
+  if ((!last && len % full != 0) || (first > 0 && text_len == 0)) {
+    return false;
+  }
+
+  const size_t n = chunk_cnt(text_len, chunk_len);
+  if (first + n - 1 > std::numeric_limits<uint32_t>::max()) {
+    return false;
+  }
+
+  const std::span<const uint8_t> ad{ data, data_len };
+
+  // i-th chunk, as an independent job, whose nonce is written to `nonce`
+  auto job = [&](const size_t i, uint8_t* const nonce) {
+    const size_t off = i * chunk_len;
+    const size_t clen = std::min(chunk_len, text_len - off);
+    const uint32_t idx = static_cast<uint32_t>(first + i);
+    const uint8_t* const sealed = in + i * full;
+
+    chunk_nonce(prefix, idx, last && i == n - 1, nonce);
+
+    // tag is only read, while decrypting
+    uint8_t* const tag = const_cast<uint8_t*>(sealed + clen);
+
+    return parallel::job_t{
+      key, nonce, ad, { sealed, clen }, { text + off, clen }, tag
+    };
+  };
+
+  bool flag = true;
+
+  if (pool == nullptr) {
+    uint8_t nonce[12];
+
+    for (size_t i = 0; i < n; i++) {
+      flag &= parallel::decrypt_job<v, fbk>(job(i, nonce));
+    }
+  } else {
+    std::vector<uint8_t> nonces(n * 12);
+    std::vector<parallel::job_t> jobs(n);
+
+    for (size_t i = 0; i < n; i++) {
+      jobs[i] = job(i, nonces.data() + i * 12);
+    }
+
+    const std::vector<bool> flags = pool->decrypt<v, fbk>(jobs);
+    for (size_t i = 0; i < n; i++) {
+      flag &= flags[i];
+    }
+  }
+
+  // prevent release of unverified plain text ( RUP ), of any chunk
+  std::memset(text, 0, !flag * text_len);
+  return flag;
+}
+
+// Chunked authenticated encryption of N -bytes plain text, using
+// TinyJambu-{128, 192, 256}, writing `sealed_len(N, chunk_len)` -bytes
+// encrypted object to `out`. When `pool` is given, chunks are encrypted in
+// parallel, on its workers, otherwise they're encrypted one after another, on
+// calling thread. Either way, output is same. Returns false, without writing
+// anything, if plain text spans more than 2^32 chunks.
+//
+// Note, `text` & `out` must not overlap.
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+inline bool
+encrypt(const uint8_t* const __restrict key,    // secret key
+        const uint8_t* const __restrict prefix, // 7 -bytes nonce prefix
+        const uint8_t* const __restrict data,   // associated data
+        const size_t data_len,                  // associated data byte length
+        const uint8_t* const __restrict text,   // plain text
+        const size_t len,                       // plain text byte length
+        const size_t chunk_len,                 // plain text bytes per chunk
+        uint8_t* const __restrict out,          // encrypted object
+        parallel::pool* const pool = nullptr    // optional worker pool
+)
+{
+  return encrypt_chunks<v, fbk>(
+    key, prefix, data, data_len, 0, text, len, chunk_len, true, out, pool);
+}
+
+// Chunked verified decryption of N -bytes encrypted object, using
+// TinyJambu-{128, 192, 256}, writing plain text ( of byte length as computed
+// by `opened_len` ) to `text`. Returns truth value only if N is a valid
+// encrypted object length & all chunks are authentic, in their original order,
+// with none missing/ appended. When `pool` is given, chunks are decrypted in
+// parallel, on its workers, otherwise they're decrypted one after another, on
+// calling thread.
+//
+// Note, `in` & `text` must not overlap.
+//
+// Note, if returned boolean verification status is not truth value, whole
+// plain text is zeroed, so don't consume it !
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+inline bool
+decrypt(const uint8_t* const __restrict key,    // secret key
+        const uint8_t* const __restrict prefix, // 7 -bytes nonce prefix
+        const uint8_t* const __restrict data,   // associated data
+        const size_t data_len,                  // associated data byte length
+        const uint8_t* const __restrict in,     // encrypted object
+        const size_t len,                       // encrypted object byte length
+        const size_t chunk_len,                 // plain text bytes per chunk
+        uint8_t* const __restrict text,         // plain text
+        parallel::pool* const pool = nullptr    // optional worker pool
+)
+{
+  return decrypt_chunks<v, fbk>(
+    key, prefix, data, data_len, 0, in, len, chunk_len, true, text, pool);
+}
+
+}
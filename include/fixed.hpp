@@ -0,0 +1,190 @@
+#pragma once
+#include "tinyjambu.hpp"
+
+// Fixed-length variants of TinyJambu-{128, 192, 256} AEAD routines, where byte
+// lengths of associated data & plain/ cipher text are template parameters, so
+// that # -of full words, framebits of partial word & its byte mask are all
+// resolved at compile-time, while each word's permutation is unrolled into
+// straight-line code, without any loop or length dependent branch. Meant for
+// protocols using few fixed-size record shapes ( say 16 -bytes associated data
+// & 48 -bytes payload ).
+namespace tinyjambu {
+
+// Fixed-length counterpart of `process_associated_data`, for `data_len` -bytes
+// associated data
+template<const variant v, const size_t data_len, const fbk_t fbk = DEFAULT_FBK>
+static inline constexpr void
+process_associated_data_fixed(
+  uint32_t* const __restrict state,     // 128 -bit state
+  const uint32_t* const __restrict key, // {128, 192, 256} -bit secret key
+  const uint8_t* const __restrict data  // `data_len` -bytes associated data
+)
+{
+  constexpr size_t full_byte_cnt = data_len & (~3ul);
+  constexpr size_t part_byte_cnt = data_len & 3ul;
+
+  unroll<(full_byte_cnt >> 2)>([&](const auto i) {
+    state[1] ^= FRAMEBITS_AD;
+
+    permute<v, 640ul, fbk>(state, key);
+
+    state[3] ^= from_le_bytes(data + (i << 2));
+  });
+
+  if constexpr (part_byte_cnt > 0ul) {
+    state[1] ^= FRAMEBITS_AD;
+
+    permute<v, 640ul, fbk>(state, key);
+
+    state[3] ^= from_le_bytes(data + full_byte_cnt, part_byte_cnt);
+  }
+
+  state[1] ^= static_cast<uint32_t>(part_byte_cnt);
+}
+
+// Fixed-length counterpart of `process_plain_text`, for `ct_len` -bytes plain
+// text
+template<const variant v, const size_t ct_len, const fbk_t fbk = DEFAULT_FBK>
+static inline constexpr void
+process_plain_text_fixed(
+  uint32_t* const __restrict state,     // 128 -bit state
+  const uint32_t* const __restrict key, // {128, 192, 256} -bit secret key
+  const uint8_t* const text,            // `ct_len` -bytes plain text
+  uint8_t* const cipher                 // `ct_len` -bytes cipher text
+)
+{
+  constexpr size_t full_byte_cnt = ct_len & (~3ul);
+  constexpr size_t part_byte_cnt = ct_len & 3ul;
+
+  unroll<(full_byte_cnt >> 2)>([&](const auto i) {
+    state[1] ^= FRAMEBITS_CT;
+
+    permute<v, key_rounds<v>(), fbk>(state, key);
+
+    const uint32_t word = from_le_bytes(text + (i << 2));
+
+    state[3] ^= word;
+    to_le_bytes(state[2] ^ word, cipher + (i << 2));
+  });
+
+  if constexpr (part_byte_cnt > 0ul) {
+    state[1] ^= FRAMEBITS_CT;
+
+    permute<v, key_rounds<v>(), fbk>(state, key);
+
+    const uint32_t word = from_le_bytes(text + full_byte_cnt, part_byte_cnt);
+
+    state[3] ^= word;
+    to_le_bytes(state[2] ^ word, cipher + full_byte_cnt, part_byte_cnt);
+  }
+
+  state[1] ^= static_cast<uint32_t>(part_byte_cnt);
+}
+
+// Fixed-length counterpart of `process_cipher_text`, for `ct_len` -bytes
+// cipher text
+template<const variant v, const size_t ct_len, const fbk_t fbk = DEFAULT_FBK>
+static inline constexpr void
+process_cipher_text_fixed(
+  uint32_t* const __restrict state,     // 128 -bit state
+  const uint32_t* const __restrict key, // {128, 192, 256} -bit secret key
+  const uint8_t* const cipher,          // `ct_len` -bytes cipher text
+  uint8_t* const text                   // `ct_len` -bytes plain text
+)
+{
+  constexpr size_t full_byte_cnt = ct_len & (~3ul);
+  constexpr size_t part_byte_cnt = ct_len & 3ul;
+
+  unroll<(full_byte_cnt >> 2)>([&](const auto i) {
+    state[1] ^= FRAMEBITS_CT;
+
+    permute<v, key_rounds<v>(), fbk>(state, key);
+
+    const uint32_t dec = state[2] ^ from_le_bytes(cipher + (i << 2));
+
+    state[3] ^= dec;
+    to_le_bytes(dec, text + (i << 2));
+  });
+
+  if constexpr (part_byte_cnt > 0ul) {
+    state[1] ^= FRAMEBITS_CT;
+
+    permute<v, key_rounds<v>(), fbk>(state, key);
+
+    constexpr uint32_t mask = 0xffffffffu >> ((4ul - part_byte_cnt) << 3);
+
+    const uint32_t word = from_le_bytes(cipher + full_byte_cnt, part_byte_cnt);
+    const uint32_t dec = state[2] ^ word;
+
+    state[3] ^= (dec & mask);
+    to_le_bytes(dec, text + full_byte_cnt, part_byte_cnt);
+  }
+
+  state[1] ^= static_cast<uint32_t>(part_byte_cnt);
+}
+
+// Authenticated encryption of `data_len` -bytes associated data & `ct_len`
+// -bytes plain text, using TinyJambu-{128, 192, 256}, producing same cipher
+// text & authentication tag as runtime length one-shot `encrypt`
+template<const variant v,
+         const size_t data_len,
+         const size_t ct_len,
+         const fbk_t fbk = DEFAULT_FBK>
+static inline constexpr void
+encrypt_fixed(const uint8_t* const __restrict key,   // secret key
+              const uint8_t* const __restrict nonce, // 96 -bit nonce
+              const uint8_t* const __restrict data,  // associated data
+              const uint8_t* const text,             // plain text
+              uint8_t* const cipher,                 // cipher text
+              uint8_t* const __restrict tag          // 64 -bit tag
+)
+{
+  uint32_t state[4]{};
+  uint32_t key_[key_word_cnt<v>()];
+
+  load_key<v>(key, key_);
+
+  initialize<v, fbk>(state, key_, nonce);
+  process_associated_data_fixed<v, data_len, fbk>(state, key_, data);
+  process_plain_text_fixed<v, ct_len, fbk>(state, key_, text, cipher);
+  finalize<v, fbk>(state, key_, tag);
+}
+
+// Verified decryption of `data_len` -bytes associated data & `ct_len` -bytes
+// cipher text, using TinyJambu-{128, 192, 256}, producing same plain text &
+// verification flag as runtime length one-shot `decrypt`
+//
+// Note, if returned boolean verification status is not truth value, plain text
+// is zeroed, so don't consume it !
+template<const variant v,
+         const size_t data_len,
+         const size_t ct_len,
+         const fbk_t fbk = DEFAULT_FBK>
+static inline constexpr bool
+decrypt_fixed(const uint8_t* const __restrict key,   // secret key
+              const uint8_t* const __restrict nonce, // 96 -bit nonce
+              const uint8_t* const __restrict tag,   // 64 -bit tag
+              const uint8_t* const __restrict data,  // associated data
+              const uint8_t* const cipher,           // cipher text
+              uint8_t* const text                    // plain text
+)
+{
+  uint32_t state[4]{};
+  uint32_t key_[key_word_cnt<v>()];
+  uint8_t tag_[8]{};
+
+  load_key<v>(key, key_);
+
+  initialize<v, fbk>(state, key_, nonce);
+  process_associated_data_fixed<v, data_len, fbk>(state, key_, data);
+  process_cipher_text_fixed<v, ct_len, fbk>(state, key_, cipher, text);
+  finalize<v, fbk>(state, key_, tag_);
+
+  const bool flag = mismatch(tag, tag_);
+
+  // prevent release of unverified plain text ( RUP )
+  wipe(text, flag * ct_len);
+  return !flag;
+}
+
+}
@@ -0,0 +1,391 @@
+#pragma once
+#include "tinyjambu.hpp"
+#include <array>
+
+// Commonly used routines in TinyJambu-{128, 192, 256} Authenticated Encryption
+// with Associated Data ( AEAD ) cipher suite
+namespace tinyjambu {
+
+template<const variant v, const fbk_t fbk>
+class nonce_prefix_context;
+
+// Reusable secret key context for TinyJambu-{128, 192, 256} AEAD, which
+// interprets secret key bytes as 32 -bit words & runs key setup phase ( i.e.
+// 1024/ 1152/ 1280 rounds of `state_update` on zeroed state ) only once, while
+// keeping resulting 128 -bit permutation state. Each message encrypted/
+// decrypted under this context starts from that stored state, skipping key
+// setup, which is a large share of work for small messages.
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+class key_context
+{
+private:
+  uint32_t key_[key_word_cnt<v>()];
+  uint32_t state_[4];
+
+  friend class nonce_prefix_context<v, fbk>;
+
+public:
+  // Prepares key context from {16, 24, 32} -bytes secret key
+  explicit key_context(const uint8_t* const __restrict key)
+  {
+    load_key<v>(key, key_);
+    setup_key<v, fbk>(state_, key_);
+  }
+
+  // Zeroes cached key words & post key setup state, so that secret key
+  // material doesn't outlive this context. Empty inline assembly, taking both
+  // arrays as input, keeps compiler from eliding those stores to an object,
+  // whose lifetime is ending.
+  ~key_context()
+  {
+    wipe(reinterpret_cast<uint8_t*>(key_), sizeof(key_));
+    wipe(reinterpret_cast<uint8_t*>(state_), sizeof(state_));
+    asm volatile("" : : "r"(key_), "r"(state_) : "memory");
+  }
+
+  // Authenticated encryption of M -bytes plain text, under secret key of this
+  // context, computing M -bytes cipher text & 64 -bit authentication tag. It
+  // produces same output as `tinyjambu_{128, 192, 256}::encrypt`, while `text`
+  // & `cipher` may also point to same memory.
+  inline void encrypt(
+    const uint8_t* const __restrict nonce, // 96 -bit public message nonce
+    const uint8_t* const __restrict data,  // associated data
+    const size_t data_len,                 // associated data byte length
+    const uint8_t* const text,             // plain text
+    uint8_t* const cipher,                 // cipher text
+    const size_t ct_len,                   // plain/ cipher text byte length
+    uint8_t* const __restrict tag          // 64 -bit authentication tag
+  ) const
+  {
+    uint32_t state[4]{ state_[0], state_[1], state_[2], state_[3] };
+
+    for (size_t i = 0; i < 3; i++) {
+      setup_nonce_word<v, fbk>(state, key_, nonce + i * 4);
+    }
+
+    process_associated_data<v, fbk>(state, key_, data, data_len);
+    process_plain_text<v, fbk>(state, key_, text, cipher, ct_len);
+    finalize<v, fbk>(state, key_, tag);
+  }
+
+  // Verified decryption of M -bytes cipher text, under secret key of this
+  // context, computing M -bytes plain text & boolean verification flag. It
+  // produces same output as `tinyjambu_{128, 192, 256}::decrypt`, while
+  // `cipher` & `text` may also point to same memory.
+  //
+  // Note, if returned boolean verification status is not truth value, don't
+  // consume decrypted bytes !
+  inline bool decrypt(
+    const uint8_t* const __restrict nonce,  // 96 -bit public message nonce
+    const uint8_t* const __restrict tag,    // 64 -bit authentication tag
+    const uint8_t* const __restrict data,   // associated data
+    const size_t data_len,                  // associated data byte length
+    const uint8_t* const cipher,            // cipher text
+    uint8_t* const text,                    // plain text
+    const size_t ct_len                     // cipher/ plain text byte length
+  ) const
+  {
+    uint32_t state[4]{ state_[0], state_[1], state_[2], state_[3] };
+    uint8_t tag_[8]{};
+
+    for (size_t i = 0; i < 3; i++) {
+      setup_nonce_word<v, fbk>(state, key_, nonce + i * 4);
+    }
+
+    process_associated_data<v, fbk>(state, key_, data, data_len);
+    process_cipher_text<v, fbk>(state, key_, cipher, text, ct_len);
+    finalize<v, fbk>(state, key_, tag_);
+
+    const bool flag = mismatch(tag, tag_);
+
+    // prevent release of unverified plain text ( RUP )
+    std::memset(text, 0, flag * ct_len);
+    return !flag;
+  }
+
+  // Verify-only decryption of M -bytes cipher text, under secret key of this
+  // context, returning same boolean verification flag as `decrypt`, without
+  // computing ( or writing ) any plain text
+  inline bool verify(
+    const uint8_t* const __restrict nonce,  // 96 -bit public message nonce
+    const uint8_t* const __restrict tag,    // 64 -bit authentication tag
+    const uint8_t* const __restrict data,   // associated data
+    const size_t data_len,                  // associated data byte length
+    const uint8_t* const __restrict cipher, // cipher text
+    const size_t ct_len                     // cipher text byte length
+  ) const
+  {
+    uint32_t state[4]{ state_[0], state_[1], state_[2], state_[3] };
+    uint8_t tag_[8]{};
+
+    for (size_t i = 0; i < 3; i++) {
+      setup_nonce_word<v, fbk>(state, key_, nonce + i * 4);
+    }
+
+    process_associated_data<v, fbk>(state, key_, data, data_len);
+    authenticate_cipher_text<v, fbk>(state, key_, cipher, ct_len);
+    finalize<v, fbk>(state, key_, tag_);
+
+    return !mismatch(tag, tag_);
+  }
+};
+
+// Reusable secret key & nonce prefix context for TinyJambu-{128, 192, 256}
+// AEAD, meant for counter-style nonces, where first 8 -bytes of 96 -bit nonce
+// ( say session id ) stay same for many messages & only last 4 -bytes ( say
+// message counter ) change. Nonce setup absorbs nonce one 32 -bit word at a
+// time, so permutation state after key setup & absorption of first two nonce
+// words is same for all those messages. This context keeps that state, so that
+// each message only runs last 640 -rounds nonce setup step, before processing
+// associated data.
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+class nonce_prefix_context
+{
+private:
+  uint32_t key_[key_word_cnt<v>()];
+  uint32_t state_[4];
+
+public:
+  // Prepares nonce prefix context from key context & first 8 -bytes of nonce
+  nonce_prefix_context(const key_context<v, fbk>& kctx,
+                       const uint8_t* const __restrict prefix)
+  {
+    std::memcpy(key_, kctx.key_, sizeof(key_));
+    std::memcpy(state_, kctx.state_, sizeof(state_));
+
+    setup_nonce_word<v, fbk>(state_, key_, prefix);
+    setup_nonce_word<v, fbk>(state_, key_, prefix + 4);
+  }
+
+  // Prepares nonce prefix context from {16, 24, 32} -bytes secret key & first
+  // 8 -bytes of nonce
+  nonce_prefix_context(const uint8_t* const __restrict key,
+                       const uint8_t* const __restrict prefix)
+    : nonce_prefix_context(key_context<v, fbk>{ key }, prefix)
+  {
+  }
+
+  // Zeroes cached key words & post nonce prefix setup state, same as
+  // `key_context` does
+  ~nonce_prefix_context()
+  {
+    wipe(reinterpret_cast<uint8_t*>(key_), sizeof(key_));
+    wipe(reinterpret_cast<uint8_t*>(state_), sizeof(state_));
+    asm volatile("" : : "r"(key_), "r"(state_) : "memory");
+  }
+
+  // Authenticated encryption of M -bytes plain text, under secret key & nonce
+  // prefix of this context, where `suffix` holds last 4 -bytes of 96 -bit
+  // nonce. It produces same output as `tinyjambu_{128, 192, 256}::encrypt`,
+  // when invoked with nonce = prefix || suffix.
+  inline void encrypt(
+    const uint8_t* const __restrict suffix, // last 32 -bit of nonce
+    const uint8_t* const __restrict data,   // associated data
+    const size_t data_len,                  // associated data byte length
+    const uint8_t* const text,              // plain text
+    uint8_t* const cipher,                  // cipher text
+    const size_t ct_len,                    // plain/ cipher text byte length
+    uint8_t* const __restrict tag           // 64 -bit authentication tag
+  ) const
+  {
+    uint32_t state[4]{ state_[0], state_[1], state_[2], state_[3] };
+
+    setup_nonce_word<v, fbk>(state, key_, suffix);
+    process_associated_data<v, fbk>(state, key_, data, data_len);
+    process_plain_text<v, fbk>(state, key_, text, cipher, ct_len);
+    finalize<v, fbk>(state, key_, tag);
+  }
+
+  // Verified decryption of M -bytes cipher text, under secret key & nonce
+  // prefix of this context, where `suffix` holds last 4 -bytes of 96 -bit
+  // nonce. It produces same output as `tinyjambu_{128, 192, 256}::decrypt`,
+  // when invoked with nonce = prefix || suffix.
+  //
+  // Note, if returned boolean verification status is not truth value, don't
+  // consume decrypted bytes !
+  inline bool decrypt(
+    const uint8_t* const __restrict suffix, // last 32 -bit of nonce
+    const uint8_t* const __restrict tag,    // 64 -bit authentication tag
+    const uint8_t* const __restrict data,   // associated data
+    const size_t data_len,                  // associated data byte length
+    const uint8_t* const cipher,            // cipher text
+    uint8_t* const text,                    // plain text
+    const size_t ct_len                     // cipher/ plain text byte length
+  ) const
+  {
+    uint32_t state[4]{ state_[0], state_[1], state_[2], state_[3] };
+    uint8_t tag_[8]{};
+
+    setup_nonce_word<v, fbk>(state, key_, suffix);
+    process_associated_data<v, fbk>(state, key_, data, data_len);
+    process_cipher_text<v, fbk>(state, key_, cipher, text, ct_len);
+    finalize<v, fbk>(state, key_, tag_);
+
+    const bool flag = mismatch(tag, tag_);
+
+    // prevent release of unverified plain text ( RUP )
+    std::memset(text, 0, flag * ct_len);
+    return !flag;
+  }
+
+  // Verify-only decryption of M -bytes cipher text, under secret key & nonce
+  // prefix of this context, returning same boolean verification flag as
+  // `decrypt`, without computing ( or writing ) any plain text
+  inline bool verify(
+    const uint8_t* const __restrict suffix, // last 32 -bit of nonce
+    const uint8_t* const __restrict tag,    // 64 -bit authentication tag
+    const uint8_t* const __restrict data,   // associated data
+    const size_t data_len,                  // associated data byte length
+    const uint8_t* const __restrict cipher, // cipher text
+    const size_t ct_len                     // cipher text byte length
+  ) const
+  {
+    uint32_t state[4]{ state_[0], state_[1], state_[2], state_[3] };
+    uint8_t tag_[8]{};
+
+    setup_nonce_word<v, fbk>(state, key_, suffix);
+    process_associated_data<v, fbk>(state, key_, data, data_len);
+    authenticate_cipher_text<v, fbk>(state, key_, cipher, ct_len);
+    finalize<v, fbk>(state, key_, tag_);
+
+    return !mismatch(tag, tag_);
+  }
+};
+
+// {16, 24, 32} -bytes secret key of TinyJambu-{128, 192, 256}, usable as
+// non-type template parameter
+template<const variant v>
+using key_bytes_t = std::array<uint8_t, key_word_cnt<v>() << 2>;
+
+// Compile-time counterpart of `key_context`, for deployments where secret key
+// is a build-time constant ( say appliance builds ). Both key words & post key
+// setup permutation state ( i.e. 1024/ 1152/ 1280 rounds of `state_update` on
+// zeroed state ) are computed by compiler & baked into binary, so that each
+// message starts directly at nonce setup.
+//
+// Feedback bit width defaults to `fbk_all`, because then every key word index
+// is a compile-time constant, letting compiler fold key words into round code
+// as immediate operands, instead of loading them from memory. For that to
+// happen, permutation calls must be inlined into encrypt/ decrypt/ verify
+// routines, which is why those are flattened.
+template<const variant v,
+         const key_bytes_t<v> key,
+         const fbk_t fbk = fbk_t::fbk_all>
+class static_key_context
+{
+private:
+  // Interprets secret key bytes as 32 -bit words, at compile-time
+  static consteval std::array<uint32_t, key_word_cnt<v>()> key_words()
+  {
+    std::array<uint32_t, key_word_cnt<v>()> words{};
+    load_key<v>(key.data(), words.data());
+    return words;
+  }
+
+  // Runs key setup, at compile-time
+  static consteval std::array<uint32_t, 4> key_state()
+  {
+    const std::array<uint32_t, key_word_cnt<v>()> words = key_words();
+    std::array<uint32_t, 4> state{};
+
+    setup_key<v, fbk>(state.data(), words.data());
+    return state;
+  }
+
+  static constexpr std::array<uint32_t, key_word_cnt<v>()> key_ = key_words();
+  static constexpr std::array<uint32_t, 4> state_ = key_state();
+
+  // Runs nonce setup & processes associated data, starting from post key
+  // setup state
+  static constexpr void start(uint32_t* const __restrict state,
+                              const uint8_t* const __restrict nonce,
+                              const uint8_t* const __restrict data,
+                              const size_t data_len)
+  {
+    for (size_t i = 0; i < 4; i++) {
+      state[i] = state_[i];
+    }
+    for (size_t i = 0; i < 3; i++) {
+      setup_nonce_word<v, fbk>(state, key_.data(), nonce + i * 4);
+    }
+
+    process_associated_data<v, fbk>(state, key_.data(), data, data_len);
+  }
+
+public:
+  // Authenticated encryption of M -bytes plain text, under compile-time
+  // secret key, computing M -bytes cipher text & 64 -bit authentication tag.
+  // It produces same output as `tinyjambu_{128, 192, 256}::encrypt`, while
+  // `text` & `cipher` may also point to same memory.
+  __attribute__((flatten)) static constexpr void encrypt(
+    const uint8_t* const __restrict nonce, // 96 -bit public message nonce
+    const uint8_t* const __restrict data,  // associated data
+    const size_t data_len,                 // associated data byte length
+    const uint8_t* const text,             // plain text
+    uint8_t* const cipher,                 // cipher text
+    const size_t ct_len,                   // plain/ cipher text byte length
+    uint8_t* const __restrict tag          // 64 -bit authentication tag
+  )
+  {
+    uint32_t state[4]{};
+
+    start(state, nonce, data, data_len);
+    process_plain_text<v, fbk>(state, key_.data(), text, cipher, ct_len);
+    finalize<v, fbk>(state, key_.data(), tag);
+  }
+
+  // Verified decryption of M -bytes cipher text, under compile-time secret
+  // key, computing M -bytes plain text & boolean verification flag. It
+  // produces same output as `tinyjambu_{128, 192, 256}::decrypt`, while
+  // `cipher` & `text` may also point to same memory.
+  //
+  // Note, if returned boolean verification status is not truth value, plain
+  // text is zeroed, so don't consume it !
+  __attribute__((flatten)) static constexpr bool decrypt(
+    const uint8_t* const __restrict nonce, // 96 -bit public message nonce
+    const uint8_t* const __restrict tag,   // 64 -bit authentication tag
+    const uint8_t* const __restrict data,  // associated data
+    const size_t data_len,                 // associated data byte length
+    const uint8_t* const cipher,           // cipher text
+    uint8_t* const text,                   // plain text
+    const size_t ct_len                    // cipher/ plain text byte length
+  )
+  {
+    uint32_t state[4]{};
+    uint8_t tag_[8]{};
+
+    start(state, nonce, data, data_len);
+    process_cipher_text<v, fbk>(state, key_.data(), cipher, text, ct_len);
+    finalize<v, fbk>(state, key_.data(), tag_);
+
+    const bool flag = mismatch(tag, tag_);
+
+    // prevent release of unverified plain text ( RUP )
+    wipe(text, flag * ct_len);
+    return !flag;
+  }
+
+  // Verify-only decryption of M -bytes cipher text, under compile-time secret
+  // key, returning same boolean verification flag as `decrypt`, without
+  // computing ( or writing ) any plain text
+  __attribute__((flatten)) static constexpr bool verify(
+    const uint8_t* const __restrict nonce,  // 96 -bit public message nonce
+    const uint8_t* const __restrict tag,    // 64 -bit authentication tag
+    const uint8_t* const __restrict data,   // associated data
+    const size_t data_len,                  // associated data byte length
+    const uint8_t* const __restrict cipher, // cipher text
+    const size_t ct_len                     // cipher text byte length
+  )
+  {
+    uint32_t state[4]{};
+    uint8_t tag_[8]{};
+
+    start(state, nonce, data, data_len);
+    authenticate_cipher_text<v, fbk>(state, key_.data(), cipher, ct_len);
+    finalize<v, fbk>(state, key_.data(), tag_);
+
+    return !mismatch(tag, tag_);
+  }
+};
+
+}
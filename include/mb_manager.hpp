@@ -0,0 +1,350 @@
+#pragma once
+#include "stream.hpp"
+#include "tinyjambu_batch.hpp"
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <span>
+
+// Multi-buffer TinyJambu-{128, 192, 256} AEAD job manager, in style of
+// ipsec-mb's multi-buffer managers, which keeps all SIMD lanes busy, even when
+// jobs of very different lengths are mixed, by letting each lane pick up next
+// job as soon as its current one finishes
+namespace tinyjambu::mb {
+
+// Status of a job, submitted to manager
+enum class status_t : uint8_t
+{
+  pending,     // job is being processed
+  completed,   // job is encrypted/ decrypted & verified
+  auth_failed, // authentication tag didn't match, plain text is zeroed
+};
+
+// One independent AEAD job, where `in` & `out` are plain & cipher text (
+// respectively ) when encrypting, while they're swapped when decrypting. Both
+// of them must be of same length. Authentication tag is written to `tag` when
+// encrypting, while it's read from there when decrypting.
+struct job_t
+{
+  direction_t dir;               // encrypt or decrypt ?
+  const uint8_t* key;            // {128, 192, 256} -bit secret key
+  const uint8_t* nonce;          // 96 -bit public message nonce
+  std::span<const uint8_t> data; // associated data
+  std::span<const uint8_t> in;   // plain/ cipher text
+  std::span<uint8_t> out;        // cipher/ plain text
+  uint8_t* tag;                  // 64 -bit authentication tag
+  status_t status;               // set by manager
+};
+
+// Multi-buffer job manager, processing upto N ( = # -of lanes in `T` ) jobs
+// at a time, one per SIMD lane.
+//
+// Each lane runs a small state machine, walking through key setup, nonce,
+// associated data, plain/ cipher text & tag phases of its job, where each phase
+// is a sequence of permutations, same as `initialize`, `process_*` &
+// `finalize` do. All lanes are advanced together, 128 rounds at a time ( i.e.
+// a tick ), which is a common divisor of all permutation lengths ( 640/ 1024/
+// 1152/ 1280 rounds ). As 128 rounds consume 4 key words, each lane's key is
+// stored in a circular window of key words, rotated such that every lane reads
+// right words for its own position within its own permutation, so lanes don't
+// need to be in same phase, or even in same kind of permutation, and no lane
+// is ever masked, while it has a job. Per-lane work is only done when a lane
+// finishes a permutation ( i.e. mixing in a word of input, writing a word of
+// output ), where it immediately moves on to next permutation or next job.
+//
+// Usage, like ipsec-mb: `submit` jobs one after another, each of which may
+// return a completed job ( not necessarily same one ), then call `flush`
+// until it returns nullptr, to complete all jobs in flight. Jobs ( & buffers
+// they refer to ) must stay alive until they're returned.
+template<const variant v,
+         const fbk_t fbk = DEFAULT_FBK,
+         typename T = lanes_t>
+class manager
+{
+private:
+  static constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+  static constexpr size_t KW = key_word_cnt<v>();
+
+  // Rounds processed per tick
+  static constexpr size_t TICK_ROUNDS = 128;
+
+  // Phases of a job, in order
+  enum class phase_t : uint8_t
+  {
+    key,
+    nonce,
+    data,
+    text,
+    tag,
+  };
+
+  // State machine of a lane
+  struct lane_t
+  {
+    job_t* job = nullptr;
+    phase_t phase = phase_t::key;
+    size_t idx = 0; // index of permutation, within phase
+    size_t cnt = 0; // # -of permutations in phase
+    uint32_t key[KW]{};
+    uint8_t tag[8]{};
+  };
+
+  T state_[4]{};
+  // circular window of key words, per lane, where first 4 words are repeated
+  // at its end, so that a tick never wraps around
+  T key_[KW + 4]{};
+  size_t win_ = 0; // first key word of window, for current tick
+
+  lane_t lanes_[N]{};
+  size_t left_[N]{}; // ticks left in current permutation, per lane
+  size_t busy_ = 0;
+
+  std::deque<job_t*> done_;
+
+  uint64_t ticks_ = 0;
+  uint64_t lane_ticks_ = 0;
+
+  // Reads/ writes 32 -bit word of lane `l`
+  static uint32_t get(const T& w, const size_t l) { return w[l]; }
+  static void set(T& w, const size_t l, const uint32_t x) { w[l] = x; }
+
+  // # -of 32 -bit words, for N -bytes input
+  static constexpr size_t words(const size_t len) { return (len + 3) >> 2; }
+
+  // Starts next permutation of lane `l`, of `rounds` -many rounds, after
+  // xoring `framebits` into state[1], by placing lane's key in key window, such
+  // that first tick reads key words starting from 0
+  void begin(const size_t l, const size_t rounds, const uint32_t framebits)
+  {
+    set(state_[1], l, get(state_[1], l) ^ framebits);
+
+    for (size_t i = 0; i < KW; i++) {
+      const size_t pos = (win_ + i) % KW;
+
+      set(key_[pos], l, lanes_[l].key[i]);
+      if (pos < 4) {
+        set(key_[pos + KW], l, lanes_[l].key[i]);
+      }
+    }
+
+    left_[l] = rounds / TICK_ROUNDS;
+  }
+
+  // Starts permutation of lane `l`'s current phase, skipping phases which
+  // don't need any ( say empty associated data ), until one does or job is
+  // finished
+  void advance(const size_t l)
+  {
+    lane_t& ln = lanes_[l];
+    job_t* const j = ln.job;
+
+    while (ln.idx == ln.cnt) {
+      switch (ln.phase) {
+        case phase_t::key:
+          ln.phase = phase_t::nonce;
+          ln.cnt = 3;
+          break;
+        case phase_t::nonce:
+          ln.phase = phase_t::data;
+          ln.cnt = words(j->data.size());
+          break;
+        case phase_t::data:
+          set(state_[1], l, get(state_[1], l) ^ (j->data.size() & 3));
+          ln.phase = phase_t::text;
+          ln.cnt = words(j->in.size());
+          break;
+        case phase_t::text:
+          set(state_[1], l, get(state_[1], l) ^ (j->in.size() & 3));
+          ln.phase = phase_t::tag;
+          ln.cnt = 2;
+          break;
+        case phase_t::tag:
+          complete(l);
+          return;
+      }
+      ln.idx = 0;
+    }
+
+    switch (ln.phase) {
+      case phase_t::key:
+        begin(l, key_rounds<v>(), 0);
+        break;
+      case phase_t::nonce:
+        begin(l, 640, FRAMEBITS_NONCE);
+        break;
+      case phase_t::data:
+        begin(l, 640, FRAMEBITS_AD);
+        break;
+      case phase_t::text:
+        begin(l, key_rounds<v>(), FRAMEBITS_CT);
+        break;
+      case phase_t::tag:
+        begin(l, ln.idx == 0 ? key_rounds<v>() : 640, FRAMEBITS_TAG);
+        break;
+    }
+  }
+
+  // Finishes current permutation of lane `l`, mixing input into ( or
+  // extracting output from ) its state, before starting next one
+  void finish(const size_t l)
+  {
+    lane_t& ln = lanes_[l];
+    job_t* const j = ln.job;
+
+    const size_t off = ln.idx << 2;
+
+    switch (ln.phase) {
+      case phase_t::key:
+        break;
+      case phase_t::nonce:
+        set(state_[3],
+            l,
+            get(state_[3], l) ^ from_le_bytes(j->nonce + off));
+        break;
+      case phase_t::data: {
+        const size_t take = std::min<size_t>(4, j->data.size() - off);
+        const uint32_t word = from_le_bytes(j->data.data() + off, take);
+
+        set(state_[3], l, get(state_[3], l) ^ word);
+      } break;
+      case phase_t::text: {
+        const size_t take = std::min<size_t>(4, j->in.size() - off);
+        const uint32_t word = from_le_bytes(j->in.data() + off, take);
+        const uint32_t res = get(state_[2], l) ^ word;
+
+        if (j->dir == direction_t::encrypt) {
+          set(state_[3], l, get(state_[3], l) ^ word);
+        } else {
+          const uint32_t mask = 0xffffffffu >> ((4ul - take) << 3);
+          set(state_[3], l, get(state_[3], l) ^ (res & mask));
+        }
+
+        to_le_bytes(res, j->out.data() + off, take);
+      } break;
+      case phase_t::tag:
+        to_le_bytes(get(state_[2], l), ln.tag + off);
+        break;
+    }
+
+    ln.idx++;
+    advance(l);
+  }
+
+  // Marks job of lane `l` as done, freeing lane
+  void complete(const size_t l)
+  {
+    lane_t& ln = lanes_[l];
+    job_t* const j = ln.job;
+
+    if (j->dir == direction_t::encrypt) {
+      std::memcpy(j->tag, ln.tag, sizeof(ln.tag));
+      j->status = status_t::completed;
+    } else {
+      const bool fail = mismatch(j->tag, ln.tag);
+
+      // prevent release of unverified plain text ( RUP )
+      std::memset(j->out.data(), 0, fail * j->out.size());
+      j->status = fail ? status_t::auth_failed : status_t::completed;
+    }
+
+    ln.job = nullptr;
+    left_[l] = 0;
+    busy_--;
+
+    done_.push_back(j);
+  }
+
+  // Advances all lanes, until at least one job is completed
+  void run()
+  {
+    while (done_.empty()) {
+      // # -of ticks, until next lane finishes its permutation
+      size_t next = std::numeric_limits<size_t>::max();
+      for (size_t l = 0; l < N; l++) {
+        if (lanes_[l].job != nullptr) {
+          next = std::min(next, left_[l]);
+        }
+      }
+
+      for (size_t t = 0; t < next; t++) {
+        // same 128 rounds for all variants, only key words differ
+        permute<variant::key_128, TICK_ROUNDS, fbk>(state_, key_ + win_);
+        win_ = (win_ + 4) % KW;
+      }
+
+      ticks_ += next;
+      lane_ticks_ += next * busy_;
+
+      for (size_t l = 0; l < N; l++) {
+        if (lanes_[l].job != nullptr) {
+          left_[l] -= next;
+          if (left_[l] == 0) {
+            finish(l);
+          }
+        }
+      }
+    }
+  }
+
+  // Returns oldest completed job
+  job_t* pop()
+  {
+    job_t* const j = done_.front();
+    done_.pop_front();
+    return j;
+  }
+
+public:
+  // Submits a job, which is placed in a free lane. Returns a completed job (
+  // not necessarily same one ), if any, or nullptr, if some lane is still free,
+  // so that more jobs are needed, before any work is done.
+  job_t* submit(job_t* const job)
+  {
+    size_t l = 0;
+    while (lanes_[l].job != nullptr) {
+      l++;
+    }
+
+    lane_t& ln = lanes_[l];
+
+    ln.job = job;
+    ln.phase = phase_t::key;
+    ln.idx = 0;
+    ln.cnt = 1;
+    load_key<v>(job->key, ln.key);
+
+    job->status = status_t::pending;
+    busy_++;
+
+    for (size_t i = 0; i < 4; i++) {
+      set(state_[i], l, 0);
+    }
+    advance(l);
+
+    if (done_.empty() && busy_ == N) {
+      run();
+    }
+    return done_.empty() ? nullptr : pop();
+  }
+
+  // Completes next job in flight, returning it, or nullptr, if no job is left
+  job_t* flush()
+  {
+    if (done_.empty() && busy_ > 0) {
+      run();
+    }
+    return done_.empty() ? nullptr : pop();
+  }
+
+  // # -of jobs submitted, but not yet returned
+  size_t in_flight() const { return busy_ + done_.size(); }
+
+  // Fraction of lane-ticks, spent on some job, since construction
+  double occupancy() const
+  {
+    return ticks_ == 0 ? 1. : static_cast<double>(lane_ticks_) / (ticks_ * N);
+  }
+};
+
+}
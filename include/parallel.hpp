@@ -0,0 +1,369 @@
+#pragma once
+#include "tinyjambu_128.hpp"
+#include "tinyjambu_192.hpp"
+#include "tinyjambu_256.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+// Multi-threaded TinyJambu-{128, 192, 256} AEAD, spreading many independent
+// messages over a fixed pool of worker threads, using work stealing
+namespace tinyjambu::parallel {
+
+// One independent AEAD job, where `in` & `out` are plain & cipher text (
+// respectively ) when encrypting, while they're swapped when decrypting. Both
+// of them must be of same length. Authentication tag is written to `tag` when
+// encrypting, while it's read from there when decrypting.
+struct job_t
+{
+  const uint8_t* key;            // {128, 192, 256} -bit secret key
+  const uint8_t* nonce;          // 96 -bit public message nonce
+  std::span<const uint8_t> data; // associated data
+  std::span<const uint8_t> in;   // plain/ cipher text
+  std::span<uint8_t> out;        // cipher/ plain text
+  uint8_t* tag;                  // 64 -bit authentication tag
+};
+
+// Authenticated encryption of single job, using TinyJambu-{128, 192, 256} &
+// `fbk` feedback bits per iteration
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+inline void
+encrypt_job(const job_t& j)
+{
+  if constexpr (v == variant::key_128) {
+    tinyjambu_128::encrypt<fbk>(j.key,
+                                j.nonce,
+                                j.data.data(),
+                                j.data.size(),
+                                j.in.data(),
+                                j.out.data(),
+                                j.in.size(),
+                                j.tag);
+  } else if constexpr (v == variant::key_192) {
+    tinyjambu_192::encrypt<fbk>(j.key,
+                                j.nonce,
+                                j.data.data(),
+                                j.data.size(),
+                                j.in.data(),
+                                j.out.data(),
+                                j.in.size(),
+                                j.tag);
+  } else {
+    tinyjambu_256::encrypt<fbk>(j.key,
+                                j.nonce,
+                                j.data.data(),
+                                j.data.size(),
+                                j.in.data(),
+                                j.out.data(),
+                                j.in.size(),
+                                j.tag);
+  }
+}
+
+// Verified decryption of single job, using TinyJambu-{128, 192, 256} & `fbk`
+// feedback bits per iteration, returning verification status
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+inline bool
+decrypt_job(const job_t& j)
+{
+  if constexpr (v == variant::key_128) {
+    return tinyjambu_128::decrypt<fbk>(j.key,
+                                       j.nonce,
+                                       j.tag,
+                                       j.data.data(),
+                                       j.data.size(),
+                                       j.in.data(),
+                                       j.out.data(),
+                                       j.in.size());
+  } else if constexpr (v == variant::key_192) {
+    return tinyjambu_192::decrypt<fbk>(j.key,
+                                       j.nonce,
+                                       j.tag,
+                                       j.data.data(),
+                                       j.data.size(),
+                                       j.in.data(),
+                                       j.out.data(),
+                                       j.in.size());
+  } else {
+    return tinyjambu_256::decrypt<fbk>(j.key,
+                                       j.nonce,
+                                       j.tag,
+                                       j.data.data(),
+                                       j.data.size(),
+                                       j.in.data(),
+                                       j.out.data(),
+                                       j.in.size());
+  }
+}
+
+// Jobs are grouped into grains of ( roughly ) these many bytes, which are units
+// of scheduling, so that cost of claiming/ stealing work is amortized over many
+// small messages, while large messages still form a grain on their own
+constexpr size_t GRAIN_BYTES = 1ul << 14;
+
+// Fixed cost ( in bytes ) accounted for each job, while grouping jobs into
+// grains, approximating key/ nonce setup & finalization of a message
+constexpr size_t JOB_COST = 32ul;
+
+// Fixed pool of worker threads, encrypting/ decrypting a batch of independent
+// jobs at a time. Jobs are grouped into grains ( see `GRAIN_BYTES` ), which are
+// split into contiguous ranges, one per worker. Each worker claims grains from
+// front of its own range & once that's exhausted, it steals half of what's left
+// in some other worker's range, so that workers stay busy even when message
+// lengths are skewed. Calling thread also works as one of the workers.
+//
+// Note, batches submitted to same pool, from many threads, are processed one
+// after another.
+class pool
+{
+private:
+  // [lo, hi) range of grain indices, owned by a worker, packed as lo || hi,
+  // so that it can be shrunk by owner/ thieves using single compare-and-swap.
+  // Each of them lives on its own cache line, to avoid false sharing.
+  struct alignas(64) range_t
+  {
+    std::atomic<uint64_t> bounds{ 0 };
+  };
+
+  static constexpr uint64_t pack(const uint64_t lo, const uint64_t hi)
+  {
+    return (lo << 32) | hi;
+  }
+
+  size_t n_;
+  std::unique_ptr<range_t[]> ranges_;
+  std::vector<std::thread> threads_;
+
+  std::mutex batch_m_; // serializes batches
+  std::mutex m_;       // guards following members
+  std::condition_variable start_cv_, done_cv_;
+  uint64_t generation_ = 0;
+  size_t active_ = 0;
+  bool stop_ = false;
+  const std::function<void(size_t)>* task_ = nullptr;
+
+  // Claims grain from front of worker `w`'s own range
+  bool pop(const size_t w, size_t& grain)
+  {
+    std::atomic<uint64_t>& r = ranges_[w].bounds;
+    uint64_t cur = r.load(std::memory_order_acquire);
+
+    while (true) {
+      const uint64_t lo = cur >> 32, hi = cur & 0xffffffffu;
+      if (lo >= hi) {
+        return false;
+      }
+      if (r.compare_exchange_weak(cur, pack(lo + 1, hi))) {
+        grain = lo;
+        return true;
+      }
+    }
+  }
+
+  // Steals back half of some other worker's range into worker `w`'s own (
+  // empty ) range, returning false only if all other workers' ranges are empty
+  bool steal(const size_t w)
+  {
+    for (size_t i = 1; i < n_; i++) {
+      std::atomic<uint64_t>& r = ranges_[(w + i) % n_].bounds;
+      uint64_t cur = r.load(std::memory_order_acquire);
+
+      while (true) {
+        const uint64_t lo = cur >> 32, hi = cur & 0xffffffffu;
+        if (lo >= hi) {
+          break;
+        }
+
+        const uint64_t mid = lo + ((hi - lo) >> 1);
+        if (r.compare_exchange_weak(cur, pack(lo, mid))) {
+          ranges_[w].bounds.store(pack(mid, hi), std::memory_order_release);
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  // Processes grains, until none is left to claim or steal
+  void work(const size_t w, const std::function<void(size_t)>& task)
+  {
+    size_t grain = 0;
+
+    while (true) {
+      if (pop(w, grain)) {
+        task(grain);
+      } else if (!steal(w)) {
+        break;
+      }
+    }
+  }
+
+  // Body of worker thread `w` ( > 0 ), waiting for batches to process
+  void worker(const size_t w)
+  {
+    uint64_t seen = 0;
+
+    while (true) {
+      const std::function<void(size_t)>* task = nullptr;
+      {
+        std::unique_lock<std::mutex> lk{ m_ };
+        start_cv_.wait(lk, [&] { return stop_ || generation_ != seen; });
+
+        if (stop_) {
+          return;
+        }
+        seen = generation_;
+        task = task_;
+      }
+
+      work(w, *task);
+
+      std::lock_guard<std::mutex> lk{ m_ };
+      if (--active_ == 0) {
+        done_cv_.notify_one();
+      }
+    }
+  }
+
+  // Invokes `task` on each of `grain_cnt` -many grains, using all workers,
+  // returning only after all of them are processed
+  void run(const size_t grain_cnt, const std::function<void(size_t)>& task)
+  {
+    if (grain_cnt == 0) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> batch_lk{ batch_m_ };
+
+    for (size_t w = 0; w < n_; w++) {
+      const uint64_t lo = grain_cnt * w / n_;
+      const uint64_t hi = grain_cnt * (w + 1) / n_;
+
+      ranges_[w].bounds.store(pack(lo, hi), std::memory_order_relaxed);
+    }
+
+    {
+      std::lock_guard<std::mutex> lk{ m_ };
+      task_ = &task;
+      active_ = n_ - 1;
+      generation_++;
+    }
+    start_cv_.notify_all();
+
+    work(0, task);
+
+    std::unique_lock<std::mutex> lk{ m_ };
+    done_cv_.wait(lk, [&] { return active_ == 0; });
+  }
+
+  // Groups jobs into grains, returning N + 1 job indices, where i-th grain
+  // holds jobs in [bounds[i], bounds[i + 1])
+  static std::vector<size_t> grains(std::span<const job_t> jobs)
+  {
+    std::vector<size_t> bounds{ 0 };
+    size_t acc = 0;
+
+    for (size_t i = 0; i < jobs.size(); i++) {
+      acc += jobs[i].data.size() + jobs[i].in.size() + JOB_COST;
+
+      if (acc >= GRAIN_BYTES) {
+        bounds.push_back(i + 1);
+        acc = 0;
+      }
+    }
+    if (bounds.back() != jobs.size()) {
+      bounds.push_back(jobs.size());
+    }
+
+    return bounds;
+  }
+
+public:
+  // Starts a pool of `n` ( > 0 ) workers, including calling thread, so n - 1
+  // threads are spawned
+  explicit pool(
+    const size_t n = std::max(1u, std::thread::hardware_concurrency()))
+    : n_{ std::max(n, 1ul) }
+    , ranges_{ std::make_unique<range_t[]>(n_) }
+  {
+    threads_.reserve(n_ - 1);
+    for (size_t w = 1; w < n_; w++) {
+      threads_.emplace_back(&pool::worker, this, w);
+    }
+  }
+
+  ~pool()
+  {
+    {
+      std::lock_guard<std::mutex> lk{ m_ };
+      stop_ = true;
+    }
+    start_cv_.notify_all();
+
+    for (std::thread& t : threads_) {
+      t.join();
+    }
+  }
+
+  pool(const pool&) = delete;
+  pool& operator=(const pool&) = delete;
+
+  // # -of workers, including calling thread
+  size_t size() const { return n_; }
+
+  // Authenticated encryption of all jobs, using TinyJambu-{128, 192, 256} &
+  // `fbk` feedback bits per iteration, producing same output as calling
+  // one-shot `encrypt` on each of them
+  template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+  void encrypt(std::span<const job_t> jobs)
+  {
+    const std::vector<size_t> bounds = grains(jobs);
+
+    const std::function<void(size_t)> task = [&](const size_t g) {
+      for (size_t i = bounds[g]; i < bounds[g + 1]; i++) {
+        encrypt_job<v, fbk>(jobs[i]);
+      }
+    };
+
+    run(bounds.size() - 1, task);
+  }
+
+  // Verified decryption of all jobs, using TinyJambu-{128, 192, 256} & `fbk`
+  // feedback bits per iteration, writing verification status of i-th job to
+  // `flags[i]` & producing same output as calling one-shot `decrypt` on each
+  // of them
+  //
+  // Note, plain text of jobs, which fail verification, is zeroed !
+  template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+  void decrypt(std::span<const job_t> jobs, std::span<bool> flags)
+  {
+    const std::vector<size_t> bounds = grains(jobs);
+
+    const std::function<void(size_t)> task = [&](const size_t g) {
+      for (size_t i = bounds[g]; i < bounds[g + 1]; i++) {
+        flags[i] = decrypt_job<v, fbk>(jobs[i]);
+      }
+    };
+
+    run(bounds.size() - 1, task);
+  }
+
+  // Verified decryption of all jobs ( see above ), returning verification
+  // status of each of them
+  template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+  std::vector<bool> decrypt(std::span<const job_t> jobs)
+  {
+    std::unique_ptr<bool[]> flags = std::make_unique<bool[]>(jobs.size());
+
+    decrypt<v, fbk>(jobs, std::span<bool>{ flags.get(), jobs.size() });
+    return std::vector<bool>(flags.get(), flags.get() + jobs.size());
+  }
+};
+
+}
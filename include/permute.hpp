@@ -1,38 +1,178 @@
 #pragma once
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
+#include <utility>
 
+// # -of feedback bits computed per iteration of `state_update` function(s),
+// which is a compile-time parameter of those functions, so that all choices can
+// coexist in same binary
+enum class fbk_t : uint8_t
+{
+  fbk_32,  // 32 feedback bits in-parallel
+  fbk_64,  // 2x32 feedback bits per iteration
+  fbk_128, // 4x32 feedback bits per iteration
+  fbk_all, // all feedback bits in straight-line code, without any loop
+  fbk_u64, // 64 feedback bits per iteration, on 2x64 -bit state limbs
+};
+
+// Default choice of feedback bit width, used when none is explicitly requested,
+// which can be set using `FBK_{32, 64, 128, ALL, U64}` macro
 #if defined FBK_32
 #pragma message("Computing 32 feedback bits in-parallel [REQUESTED]")
+constexpr fbk_t DEFAULT_FBK = fbk_t::fbk_32;
 #elif defined FBK_64
 #pragma message("Computing 64 feedback bits in-parallel [REQUESTED]")
+constexpr fbk_t DEFAULT_FBK = fbk_t::fbk_64;
 #elif defined FBK_128
 #pragma message("Computing 128 feedback bits in-parallel [REQUESTED]")
+constexpr fbk_t DEFAULT_FBK = fbk_t::fbk_128;
+#elif defined FBK_ALL
+#pragma message("Computing all feedback bits without loop [REQUESTED]")
+constexpr fbk_t DEFAULT_FBK = fbk_t::fbk_all;
+#elif defined FBK_U64
+#pragma message("Computing 64 feedback bits on 64 -bit limbs [REQUESTED]")
+constexpr fbk_t DEFAULT_FBK = fbk_t::fbk_u64;
 #else
 #define FBK_32
 #pragma message("Computing 32 feedback bits in-parallel [DEFAULT]")
+constexpr fbk_t DEFAULT_FBK = fbk_t::fbk_32;
 #endif
 
 // Compile time check to ensure that {32, 64, 128} feedback bits can be safely
 // computed per iteration round in following `state_update` function(s)
+//
+// Note, fully unrolled `state_update` updates state limbs in place, in same
+// order as 128 feedback bits per iteration does, so it has same requirement.
 consteval bool
-check_rounds(const size_t rounds)
+check_rounds(const size_t rounds, const fbk_t fbk)
 {
-#if defined FBK_32
-  return (rounds & 31ul) == 0ul;
-#elif defined FBK_64
-  return (rounds & 63ul) == 0ul;
-#elif defined FBK_128
-  return (rounds & 127ul) == 0ul;
-#endif
+  switch (fbk) {
+    case fbk_t::fbk_32:
+      return (rounds & 31ul) == 0ul;
+    case fbk_t::fbk_64:
+    case fbk_t::fbk_u64:
+      return (rounds & 63ul) == 0ul;
+    case fbk_t::fbk_128:
+    case fbk_t::fbk_all:
+      return (rounds & 127ul) == 0ul;
+  }
+  return false;
+}
+
+// Helper routines used by fully unrolled `state_update` function(s), which are
+// same for all variants, except # -of 32 -bit secret key words
+namespace tinyjambu_unrolled {
+
+// Computes `i` -th 32 feedback bits ( i.e. rounds [32 * i, 32 * (i + 1)) ),
+// updating state limb in place, where both the state limb indices & the key
+// word index are compile-time constants, so no loop counter, no mask or modulo
+// operation is left in emitted code
+//
+// Note, it's forcefully inlined, because for wider limb types ( say `words_t` )
+// compiler may otherwise decide to emit a function call for each step.
+template<const size_t key_words, const size_t i, typename T>
+static inline __attribute__((always_inline)) constexpr void
+step(T* const __restrict state, const T* const __restrict key)
+{
+  constexpr size_t j0 = (i + 0ul) & 3ul;
+  constexpr size_t j1 = (i + 1ul) & 3ul;
+  constexpr size_t j2 = (i + 2ul) & 3ul;
+  constexpr size_t j3 = (i + 3ul) & 3ul;
+  constexpr size_t k = i % key_words;
+
+  const T s47 = (state[j2] << 17) | (state[j1] >> 15);
+  const T s70 = (state[j3] << 26) | (state[j2] >> 6);
+  const T s85 = (state[j3] << 11) | (state[j2] >> 21);
+  const T s91 = (state[j3] << 5) | (state[j2] >> 27);
+
+  state[j0] = state[j0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[k];
+}
+
+// Emits straight-line code for all 32 -bit steps, one per index in `I`
+template<const size_t key_words, typename T, size_t... I>
+static inline __attribute__((always_inline)) constexpr void
+steps(T* const __restrict state,
+      const T* const __restrict key,
+      std::index_sequence<I...>)
+{
+  (step<key_words, I>(state, key), ...);
+}
+
+}
+
+// Alternative `state_update` kernel, same for all variants, except # -of 32
+// -bit secret key words, which holds 128 -bit state as two 64 -bit limbs
+//
+// ( MSB ) hi = state[3] || state[2], lo = state[1] || state[0] ( LSB )
+//
+// so that taps s70, s85 & s91 are single shifts of `hi`, while s47 is a
+// double-width shift ( i.e. `shrd` on x86_64, `extr` on AArch64 ) of `hi ||
+// lo`, instead of a shift-or pair of 32 -bit limbs, for each tap.
+//
+// Each iteration computes 64 feedback bits. Lower 32 of them only depend on
+// current state, while upper 32 also depend on lower ( freshly computed ) ones
+// through s70, s85 & s91, whose missing top bits are filled in from lower
+// feedback bits, before nonlinear term is recomputed. Linear terms ( i.e. lo ^
+// s47 ^ key ) are shared by both halves.
+namespace tinyjambu_u64 {
+
+template<const size_t key_words, const size_t rounds>
+static inline constexpr void
+state_update(uint32_t* const __restrict state,    // 128 -bit state
+             const uint32_t* const __restrict key // secret key words
+)
+{
+  static_assert((key_words & 1ul) == 0ul, "Key words must pair up");
+
+  constexpr size_t itr_cnt = rounds >> 6;
+  constexpr size_t pair_cnt = key_words >> 1;
+
+  // pairs of key words, consumed by each iteration
+  uint64_t key_[pair_cnt]{};
+  for (size_t i = 0; i < pair_cnt; i++) {
+    key_[i] = (static_cast<uint64_t>(key[2 * i + 1]) << 32) | key[2 * i];
+  }
+
+  uint64_t lo = (static_cast<uint64_t>(state[1]) << 32) | state[0];
+  uint64_t hi = (static_cast<uint64_t>(state[3]) << 32) | state[2];
+
+  for (size_t i = 0; i < itr_cnt; i++) {
+    const uint64_t s47 = (hi << 17) | (lo >> 47);
+    const uint64_t s70 = hi >> 6;
+    const uint64_t s85 = hi >> 21;
+    const uint64_t s91 = hi >> 27;
+
+    const uint64_t lin = lo ^ s47 ^ key_[i % pair_cnt];
+
+    // lower 32 feedback bits
+    const uint64_t fbk0 = (lin ^ (~(s70 & s85)) ^ s91) & 0xffffffffu;
+
+    const uint64_t s70_ = s70 | (fbk0 << 58);
+    const uint64_t s85_ = s85 | (fbk0 << 43);
+    const uint64_t s91_ = s91 | (fbk0 << 37);
+
+    // all 64 feedback bits, where lower 32 are same as above
+    const uint64_t fbk1 = lin ^ (~(s70_ & s85_)) ^ s91_;
+
+    lo = hi;
+    hi = fbk1;
+  }
+
+  state[0] = static_cast<uint32_t>(lo);
+  state[1] = static_cast<uint32_t>(lo >> 32);
+  state[2] = static_cast<uint32_t>(hi);
+  state[3] = static_cast<uint32_t>(hi >> 32);
+}
+
 }
 
 // TinyJambu-128 Authenticated Encryption with Associated Data Implementation
 namespace tinyjambu_128 {
 
-// TinyJambu-128 `StateUpdate` function, computing 32/ 128 feedback bits ( based
-// on compile-time decision ) during each iteration ( see inside body of for
-// loop )
+// TinyJambu-128 `StateUpdate` function, computing 32/ 64/ 128 feedback bits (
+// based on compile-time template parameter `fbk` ) during each iteration (
+// see inside body of for loop )
 //
 // Note, this function will update state of 128 -bit Non-Linear Feedback Shift
 // Register `rounds` -many time; so ensure that ( a compile-time check is
@@ -40,99 +180,115 @@ namespace tinyjambu_128 {
 //
 // assert rounds % 32 == 0 or assert rounds % 128 == 0
 //
+// When `fbk` is `fbk_all`, no loop is emitted, instead all `rounds` are
+// computed in straight-line code, with secret key word indices resolved at
+// compile-time.
+//
+// Each limb of state/ key is of type `T`, which is either a 32 -bit unsigned
+// integer ( default ) or a vector of N -many 32 -bit lanes, in which case N
+// independent permutation states are updated together, each one using the key
+// words found in its own lane.
+//
 // See section 3.2.3 in TinyJambu specification
 // https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/tinyjambu-spec-final.pdf
-template<const size_t rounds>
-static inline void
-state_update(uint32_t* const __restrict state,    // 128 -bit permutation state
-             const uint32_t* const __restrict key // 128 -bit secret key
+template<const size_t rounds,
+         const fbk_t fbk = DEFAULT_FBK,
+         typename T = uint32_t>
+static inline constexpr void
+state_update(T* const __restrict state,    // 128 -bit permutation state
+             const T* const __restrict key // 128 -bit secret key
              )
-  requires(check_rounds(rounds))
+  requires(check_rounds(rounds, fbk))
 {
   constexpr size_t itr_cnt = rounds >> 5;
 
-#if defined FBK_32
-
-  for (size_t i = 0; i < itr_cnt; i++) {
-    const uint32_t s47 = (state[2] << 17) | (state[1] >> 15);
-    const uint32_t s70 = (state[3] << 26) | (state[2] >> 6);
-    const uint32_t s85 = (state[3] << 11) | (state[2] >> 21);
-    const uint32_t s91 = (state[3] << 5) | (state[2] >> 27);
-
-    // computed 32 feedback bits
-    const uint32_t fbk = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[i & 3ul];
-
-    state[0] = state[1];
-    state[1] = state[2];
-    state[2] = state[3];
-    state[3] = fbk;
-  }
-
-#elif defined FBK_64
-
-  for (size_t i = 0; i < itr_cnt; i += 2) {
-    const uint32_t s47 = (state[2] << 17) | (state[1] >> 15);
-    const uint32_t s70 = (state[3] << 26) | (state[2] >> 6);
-    const uint32_t s85 = (state[3] << 11) | (state[2] >> 21);
-    const uint32_t s91 = (state[3] << 5) | (state[2] >> 27);
-
-    // computed (first) 32 feedback bits
-    const size_t idx0 = (i + 0ul) & 3ul;
-    const uint32_t fbk0 = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[idx0];
-
-    const uint32_t s47_ = (state[3] << 17) | (state[2] >> 15);
-    const uint32_t s70_ = (fbk0 << 26) | (state[3] >> 6);
-    const uint32_t s85_ = (fbk0 << 11) | (state[3] >> 21);
-    const uint32_t s91_ = (fbk0 << 5) | (state[3] >> 27);
-
-    // computed (next) 32 feedback bits
-    const size_t idx1 = (i + 1ul) & 3ul;
-    const uint32_t fbk1 = state[1] ^ s47_ ^ (~(s70_ & s85_)) ^ s91_ ^ key[idx1];
-
-    state[0] = state[2];
-    state[1] = state[3];
-    state[2] = fbk0;
-    state[3] = fbk1;
-  }
-
-#elif defined FBK_128
-
-  for (size_t i = 0; i < itr_cnt; i += 4) {
-    {
-      const uint32_t s47 = (state[2] << 17) | (state[1] >> 15);
-      const uint32_t s70 = (state[3] << 26) | (state[2] >> 6);
-      const uint32_t s85 = (state[3] << 11) | (state[2] >> 21);
-      const uint32_t s91 = (state[3] << 5) | (state[2] >> 27);
-
-      state[0] = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[0];
+  if constexpr (fbk == fbk_t::fbk_u64) {
+    // 64 -bit limbs only make sense for scalar state, vector lanes fall back to
+    // 64 feedback bits per iteration, on 32 -bit limbs
+    if constexpr (std::is_same_v<T, uint32_t>) {
+      tinyjambu_u64::state_update<4, rounds>(state, key);
+    } else {
+      state_update<rounds, fbk_t::fbk_64, T>(state, key);
     }
-    {
-      const uint32_t s47 = (state[3] << 17) | (state[2] >> 15);
-      const uint32_t s70 = (state[0] << 26) | (state[3] >> 6);
-      const uint32_t s85 = (state[0] << 11) | (state[3] >> 21);
-      const uint32_t s91 = (state[0] << 5) | (state[3] >> 27);
-
-      state[1] = state[1] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[1];
+  } else if constexpr (fbk == fbk_t::fbk_32) {
+    for (size_t i = 0; i < itr_cnt; i++) {
+      const T s47 = (state[2] << 17) | (state[1] >> 15);
+      const T s70 = (state[3] << 26) | (state[2] >> 6);
+      const T s85 = (state[3] << 11) | (state[2] >> 21);
+      const T s91 = (state[3] << 5) | (state[2] >> 27);
+
+      // computed 32 feedback bits
+      const T fbk0 = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[i & 3ul];
+
+      state[0] = state[1];
+      state[1] = state[2];
+      state[2] = state[3];
+      state[3] = fbk0;
     }
-    {
-      const uint32_t s47 = (state[0] << 17) | (state[3] >> 15);
-      const uint32_t s70 = (state[1] << 26) | (state[0] >> 6);
-      const uint32_t s85 = (state[1] << 11) | (state[0] >> 21);
-      const uint32_t s91 = (state[1] << 5) | (state[0] >> 27);
-
-      state[2] = state[2] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[2];
+  } else if constexpr (fbk == fbk_t::fbk_64) {
+    for (size_t i = 0; i < itr_cnt; i += 2) {
+      const T s47 = (state[2] << 17) | (state[1] >> 15);
+      const T s70 = (state[3] << 26) | (state[2] >> 6);
+      const T s85 = (state[3] << 11) | (state[2] >> 21);
+      const T s91 = (state[3] << 5) | (state[2] >> 27);
+
+      // computed (first) 32 feedback bits
+      const size_t idx0 = (i + 0ul) & 3ul;
+      const T fbk0 = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[idx0];
+
+      const T s47_ = (state[3] << 17) | (state[2] >> 15);
+      const T s70_ = (fbk0 << 26) | (state[3] >> 6);
+      const T s85_ = (fbk0 << 11) | (state[3] >> 21);
+      const T s91_ = (fbk0 << 5) | (state[3] >> 27);
+
+      // computed (next) 32 feedback bits
+      const size_t idx1 = (i + 1ul) & 3ul;
+      const T fbk1 = state[1] ^ s47_ ^ (~(s70_ & s85_)) ^ s91_ ^ key[idx1];
+
+      state[0] = state[2];
+      state[1] = state[3];
+      state[2] = fbk0;
+      state[3] = fbk1;
     }
-    {
-      const uint32_t s47 = (state[1] << 17) | (state[0] >> 15);
-      const uint32_t s70 = (state[2] << 26) | (state[1] >> 6);
-      const uint32_t s85 = (state[2] << 11) | (state[1] >> 21);
-      const uint32_t s91 = (state[2] << 5) | (state[1] >> 27);
-
-      state[3] = state[3] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[3];
+  } else if constexpr (fbk == fbk_t::fbk_all) {
+    using namespace tinyjambu_unrolled;
+    steps<4ul>(state, key, std::make_index_sequence<itr_cnt>{});
+  } else {
+    for (size_t i = 0; i < itr_cnt; i += 4) {
+      {
+        const T s47 = (state[2] << 17) | (state[1] >> 15);
+        const T s70 = (state[3] << 26) | (state[2] >> 6);
+        const T s85 = (state[3] << 11) | (state[2] >> 21);
+        const T s91 = (state[3] << 5) | (state[2] >> 27);
+
+        state[0] = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[0];
+      }
+      {
+        const T s47 = (state[3] << 17) | (state[2] >> 15);
+        const T s70 = (state[0] << 26) | (state[3] >> 6);
+        const T s85 = (state[0] << 11) | (state[3] >> 21);
+        const T s91 = (state[0] << 5) | (state[3] >> 27);
+
+        state[1] = state[1] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[1];
+      }
+      {
+        const T s47 = (state[0] << 17) | (state[3] >> 15);
+        const T s70 = (state[1] << 26) | (state[0] >> 6);
+        const T s85 = (state[1] << 11) | (state[0] >> 21);
+        const T s91 = (state[1] << 5) | (state[0] >> 27);
+
+        state[2] = state[2] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[2];
+      }
+      {
+        const T s47 = (state[1] << 17) | (state[0] >> 15);
+        const T s70 = (state[2] << 26) | (state[1] >> 6);
+        const T s85 = (state[2] << 11) | (state[1] >> 21);
+        const T s91 = (state[2] << 5) | (state[1] >> 27);
+
+        state[3] = state[3] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[3];
+      }
     }
   }
-
-#endif
 }
 
 }
@@ -140,9 +296,9 @@ state_update(uint32_t* const __restrict state,    // 128 -bit permutation state
 // TinyJambu-192 Authenticated Encryption with Associated Data Implementation
 namespace tinyjambu_192 {
 
-// TinyJambu-192 `StateUpdate` function, computing 32/ 128 feedback bits ( based
-// on compile-time decision ) during each iteration ( see inside body of for
-// loop )
+// TinyJambu-192 `StateUpdate` function, computing 32/ 64/ 128 feedback bits (
+// based on compile-time template parameter `fbk` ) during each iteration (
+// see inside body of for loop )
 //
 // Note, this function will update state of 128 -bit Non-Linear Feedback Shift
 // Register `rounds` -many time; so ensure that ( a compile-time check is
@@ -150,101 +306,117 @@ namespace tinyjambu_192 {
 //
 // assert rounds % 32 == 0 or assert rounds % 128 == 0
 //
+// When `fbk` is `fbk_all`, no loop is emitted, instead all `rounds` are
+// computed in straight-line code, with secret key word indices resolved at
+// compile-time.
+//
+// Each limb of state/ key is of type `T`, which is either a 32 -bit unsigned
+// integer ( default ) or a vector of N -many 32 -bit lanes, in which case N
+// independent permutation states are updated together, each one using the key
+// words found in its own lane.
+//
 // See section 3.2.3 in TinyJambu specification
 // https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/tinyjambu-spec-final.pdf
-template<const size_t rounds>
-static inline void
-state_update(uint32_t* const __restrict state,    // 128 -bit permutation state
-             const uint32_t* const __restrict key // 192 -bit secret key
+template<const size_t rounds,
+         const fbk_t fbk = DEFAULT_FBK,
+         typename T = uint32_t>
+static inline constexpr void
+state_update(T* const __restrict state,    // 128 -bit permutation state
+             const T* const __restrict key // 192 -bit secret key
              )
-  requires(check_rounds(rounds))
+  requires(check_rounds(rounds, fbk))
 {
   constexpr size_t itr_cnt = rounds >> 5;
 
-#if defined FBK_32
-
-  for (size_t i = 0; i < itr_cnt; i++) {
-    const size_t j = i % 6ul;
-
-    const uint32_t s47 = (state[2] << 17) | (state[1] >> 15);
-    const uint32_t s70 = (state[3] << 26) | (state[2] >> 6);
-    const uint32_t s85 = (state[3] << 11) | (state[2] >> 21);
-    const uint32_t s91 = (state[3] << 5) | (state[2] >> 27);
-
-    // computed 32 feedback bits
-    const uint32_t fbk = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[j];
-
-    state[0] = state[1];
-    state[1] = state[2];
-    state[2] = state[3];
-    state[3] = fbk;
-  }
-
-#elif defined FBK_64
-
-  for (size_t i = 0; i < itr_cnt; i += 2) {
-    const uint32_t s47 = (state[2] << 17) | (state[1] >> 15);
-    const uint32_t s70 = (state[3] << 26) | (state[2] >> 6);
-    const uint32_t s85 = (state[3] << 11) | (state[2] >> 21);
-    const uint32_t s91 = (state[3] << 5) | (state[2] >> 27);
-
-    // computed (first) 32 feedback bits
-    const size_t idx0 = (i + 0ul) % 6ul;
-    const uint32_t fbk0 = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[idx0];
-
-    const uint32_t s47_ = (state[3] << 17) | (state[2] >> 15);
-    const uint32_t s70_ = (fbk0 << 26) | (state[3] >> 6);
-    const uint32_t s85_ = (fbk0 << 11) | (state[3] >> 21);
-    const uint32_t s91_ = (fbk0 << 5) | (state[3] >> 27);
-
-    // computed (next) 32 feedback bits
-    const size_t idx1 = (i + 1ul) % 6ul;
-    const uint32_t fbk1 = state[1] ^ s47_ ^ (~(s70_ & s85_)) ^ s91_ ^ key[idx1];
-
-    state[0] = state[2];
-    state[1] = state[3];
-    state[2] = fbk0;
-    state[3] = fbk1;
-  }
-
-#elif defined FBK_128
-
-  for (size_t i = 0; i < itr_cnt; i += 4) {
-    {
-      const uint32_t s47 = (state[2] << 17) | (state[1] >> 15);
-      const uint32_t s70 = (state[3] << 26) | (state[2] >> 6);
-      const uint32_t s85 = (state[3] << 11) | (state[2] >> 21);
-      const uint32_t s91 = (state[3] << 5) | (state[2] >> 27);
-
-      state[0] = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 0) % 6ul];
+  if constexpr (fbk == fbk_t::fbk_u64) {
+    // 64 -bit limbs only make sense for scalar state, vector lanes fall back to
+    // 64 feedback bits per iteration, on 32 -bit limbs
+    if constexpr (std::is_same_v<T, uint32_t>) {
+      tinyjambu_u64::state_update<6, rounds>(state, key);
+    } else {
+      state_update<rounds, fbk_t::fbk_64, T>(state, key);
     }
-    {
-      const uint32_t s47 = (state[3] << 17) | (state[2] >> 15);
-      const uint32_t s70 = (state[0] << 26) | (state[3] >> 6);
-      const uint32_t s85 = (state[0] << 11) | (state[3] >> 21);
-      const uint32_t s91 = (state[0] << 5) | (state[3] >> 27);
-
-      state[1] = state[1] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 1) % 6ul];
+  } else if constexpr (fbk == fbk_t::fbk_32) {
+    for (size_t i = 0; i < itr_cnt; i++) {
+      const size_t j = i % 6ul;
+
+      const T s47 = (state[2] << 17) | (state[1] >> 15);
+      const T s70 = (state[3] << 26) | (state[2] >> 6);
+      const T s85 = (state[3] << 11) | (state[2] >> 21);
+      const T s91 = (state[3] << 5) | (state[2] >> 27);
+
+      // computed 32 feedback bits
+      const T fbk0 = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[j];
+
+      state[0] = state[1];
+      state[1] = state[2];
+      state[2] = state[3];
+      state[3] = fbk0;
     }
-    {
-      const uint32_t s47 = (state[0] << 17) | (state[3] >> 15);
-      const uint32_t s70 = (state[1] << 26) | (state[0] >> 6);
-      const uint32_t s85 = (state[1] << 11) | (state[0] >> 21);
-      const uint32_t s91 = (state[1] << 5) | (state[0] >> 27);
-
-      state[2] = state[2] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 2) % 6ul];
+  } else if constexpr (fbk == fbk_t::fbk_64) {
+    for (size_t i = 0; i < itr_cnt; i += 2) {
+      const T s47 = (state[2] << 17) | (state[1] >> 15);
+      const T s70 = (state[3] << 26) | (state[2] >> 6);
+      const T s85 = (state[3] << 11) | (state[2] >> 21);
+      const T s91 = (state[3] << 5) | (state[2] >> 27);
+
+      // computed (first) 32 feedback bits
+      const size_t idx0 = (i + 0ul) % 6ul;
+      const T fbk0 = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[idx0];
+
+      const T s47_ = (state[3] << 17) | (state[2] >> 15);
+      const T s70_ = (fbk0 << 26) | (state[3] >> 6);
+      const T s85_ = (fbk0 << 11) | (state[3] >> 21);
+      const T s91_ = (fbk0 << 5) | (state[3] >> 27);
+
+      // computed (next) 32 feedback bits
+      const size_t idx1 = (i + 1ul) % 6ul;
+      const T fbk1 = state[1] ^ s47_ ^ (~(s70_ & s85_)) ^ s91_ ^ key[idx1];
+
+      state[0] = state[2];
+      state[1] = state[3];
+      state[2] = fbk0;
+      state[3] = fbk1;
     }
-    {
-      const uint32_t s47 = (state[1] << 17) | (state[0] >> 15);
-      const uint32_t s70 = (state[2] << 26) | (state[1] >> 6);
-      const uint32_t s85 = (state[2] << 11) | (state[1] >> 21);
-      const uint32_t s91 = (state[2] << 5) | (state[1] >> 27);
-
-      state[3] = state[3] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 3) % 6ul];
+  } else if constexpr (fbk == fbk_t::fbk_all) {
+    using namespace tinyjambu_unrolled;
+    steps<6ul>(state, key, std::make_index_sequence<itr_cnt>{});
+  } else {
+    for (size_t i = 0; i < itr_cnt; i += 4) {
+      {
+        const T s47 = (state[2] << 17) | (state[1] >> 15);
+        const T s70 = (state[3] << 26) | (state[2] >> 6);
+        const T s85 = (state[3] << 11) | (state[2] >> 21);
+        const T s91 = (state[3] << 5) | (state[2] >> 27);
+
+        state[0] = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 0) % 6ul];
+      }
+      {
+        const T s47 = (state[3] << 17) | (state[2] >> 15);
+        const T s70 = (state[0] << 26) | (state[3] >> 6);
+        const T s85 = (state[0] << 11) | (state[3] >> 21);
+        const T s91 = (state[0] << 5) | (state[3] >> 27);
+
+        state[1] = state[1] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 1) % 6ul];
+      }
+      {
+        const T s47 = (state[0] << 17) | (state[3] >> 15);
+        const T s70 = (state[1] << 26) | (state[0] >> 6);
+        const T s85 = (state[1] << 11) | (state[0] >> 21);
+        const T s91 = (state[1] << 5) | (state[0] >> 27);
+
+        state[2] = state[2] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 2) % 6ul];
+      }
+      {
+        const T s47 = (state[1] << 17) | (state[0] >> 15);
+        const T s70 = (state[2] << 26) | (state[1] >> 6);
+        const T s85 = (state[2] << 11) | (state[1] >> 21);
+        const T s91 = (state[2] << 5) | (state[1] >> 27);
+
+        state[3] = state[3] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 3) % 6ul];
+      }
     }
   }
-
-#endif
 }
 
 }
@@ -252,9 +424,9 @@ state_update(uint32_t* const __restrict state,    // 128 -bit permutation state
 // TinyJambu-256 Authenticated Encryption with Associated Data Implementation
 namespace tinyjambu_256 {
 
-// TinyJambu-256 `StateUpdate` function, computing 32/ 128 feedback bits ( based
-// on compile-time decision ) during each iteration ( see inside body of
-// for loop )
+// TinyJambu-256 `StateUpdate` function, computing 32/ 64/ 128 feedback bits (
+// based on compile-time template parameter `fbk` ) during each iteration (
+// see inside body of for loop )
 //
 // Note, this function will update state of 128 -bit Non-Linear Feedback Shift
 // Register `rounds` -many time; so ensure that ( a compile-time check is
@@ -262,99 +434,115 @@ namespace tinyjambu_256 {
 //
 // assert rounds % 32 == 0 or assert rounds % 128 == 0
 //
+// When `fbk` is `fbk_all`, no loop is emitted, instead all `rounds` are
+// computed in straight-line code, with secret key word indices resolved at
+// compile-time.
+//
+// Each limb of state/ key is of type `T`, which is either a 32 -bit unsigned
+// integer ( default ) or a vector of N -many 32 -bit lanes, in which case N
+// independent permutation states are updated together, each one using the key
+// words found in its own lane.
+//
 // See section 3.2.3 in TinyJambu specification
 // https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/tinyjambu-spec-final.pdf
-template<const size_t rounds>
-static inline void
-state_update(uint32_t* const __restrict state,    // 128 -bit permutation state
-             const uint32_t* const __restrict key // 256 -bit secret key
+template<const size_t rounds,
+         const fbk_t fbk = DEFAULT_FBK,
+         typename T = uint32_t>
+static inline constexpr void
+state_update(T* const __restrict state,    // 128 -bit permutation state
+             const T* const __restrict key // 256 -bit secret key
              )
-  requires(check_rounds(rounds))
+  requires(check_rounds(rounds, fbk))
 {
   constexpr size_t itr_cnt = rounds >> 5;
 
-#if defined FBK_32
-
-  for (size_t i = 0; i < itr_cnt; i++) {
-    const uint32_t s47 = (state[2] << 17) | (state[1] >> 15);
-    const uint32_t s70 = (state[3] << 26) | (state[2] >> 6);
-    const uint32_t s85 = (state[3] << 11) | (state[2] >> 21);
-    const uint32_t s91 = (state[3] << 5) | (state[2] >> 27);
-
-    // computed 32 feedback bits
-    const uint32_t fbk = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[i & 7ul];
-
-    state[0] = state[1];
-    state[1] = state[2];
-    state[2] = state[3];
-    state[3] = fbk;
-  }
-
-#elif defined FBK_64
-
-  for (size_t i = 0; i < itr_cnt; i += 2) {
-    const uint32_t s47 = (state[2] << 17) | (state[1] >> 15);
-    const uint32_t s70 = (state[3] << 26) | (state[2] >> 6);
-    const uint32_t s85 = (state[3] << 11) | (state[2] >> 21);
-    const uint32_t s91 = (state[3] << 5) | (state[2] >> 27);
-
-    // computed (first) 32 feedback bits
-    const size_t idx0 = (i + 0ul) & 7ul;
-    const uint32_t fbk0 = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[idx0];
-
-    const uint32_t s47_ = (state[3] << 17) | (state[2] >> 15);
-    const uint32_t s70_ = (fbk0 << 26) | (state[3] >> 6);
-    const uint32_t s85_ = (fbk0 << 11) | (state[3] >> 21);
-    const uint32_t s91_ = (fbk0 << 5) | (state[3] >> 27);
-
-    // computed (next) 32 feedback bits
-    const size_t idx1 = (i + 1ul) & 7ul;
-    const uint32_t fbk1 = state[1] ^ s47_ ^ (~(s70_ & s85_)) ^ s91_ ^ key[idx1];
-
-    state[0] = state[2];
-    state[1] = state[3];
-    state[2] = fbk0;
-    state[3] = fbk1;
-  }
-
-#elif defined FBK_128
-
-  for (size_t i = 0; i < itr_cnt; i += 4) {
-    {
-      const uint32_t s47 = (state[2] << 17) | (state[1] >> 15);
-      const uint32_t s70 = (state[3] << 26) | (state[2] >> 6);
-      const uint32_t s85 = (state[3] << 11) | (state[2] >> 21);
-      const uint32_t s91 = (state[3] << 5) | (state[2] >> 27);
-
-      state[0] = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 0ul) & 7ul];
+  if constexpr (fbk == fbk_t::fbk_u64) {
+    // 64 -bit limbs only make sense for scalar state, vector lanes fall back to
+    // 64 feedback bits per iteration, on 32 -bit limbs
+    if constexpr (std::is_same_v<T, uint32_t>) {
+      tinyjambu_u64::state_update<8, rounds>(state, key);
+    } else {
+      state_update<rounds, fbk_t::fbk_64, T>(state, key);
     }
-    {
-      const uint32_t s47 = (state[3] << 17) | (state[2] >> 15);
-      const uint32_t s70 = (state[0] << 26) | (state[3] >> 6);
-      const uint32_t s85 = (state[0] << 11) | (state[3] >> 21);
-      const uint32_t s91 = (state[0] << 5) | (state[3] >> 27);
-
-      state[1] = state[1] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 1ul) & 7ul];
+  } else if constexpr (fbk == fbk_t::fbk_32) {
+    for (size_t i = 0; i < itr_cnt; i++) {
+      const T s47 = (state[2] << 17) | (state[1] >> 15);
+      const T s70 = (state[3] << 26) | (state[2] >> 6);
+      const T s85 = (state[3] << 11) | (state[2] >> 21);
+      const T s91 = (state[3] << 5) | (state[2] >> 27);
+
+      // computed 32 feedback bits
+      const T fbk0 = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[i & 7ul];
+
+      state[0] = state[1];
+      state[1] = state[2];
+      state[2] = state[3];
+      state[3] = fbk0;
     }
-    {
-      const uint32_t s47 = (state[0] << 17) | (state[3] >> 15);
-      const uint32_t s70 = (state[1] << 26) | (state[0] >> 6);
-      const uint32_t s85 = (state[1] << 11) | (state[0] >> 21);
-      const uint32_t s91 = (state[1] << 5) | (state[0] >> 27);
-
-      state[2] = state[2] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 2ul) & 7ul];
+  } else if constexpr (fbk == fbk_t::fbk_64) {
+    for (size_t i = 0; i < itr_cnt; i += 2) {
+      const T s47 = (state[2] << 17) | (state[1] >> 15);
+      const T s70 = (state[3] << 26) | (state[2] >> 6);
+      const T s85 = (state[3] << 11) | (state[2] >> 21);
+      const T s91 = (state[3] << 5) | (state[2] >> 27);
+
+      // computed (first) 32 feedback bits
+      const size_t idx0 = (i + 0ul) & 7ul;
+      const T fbk0 = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[idx0];
+
+      const T s47_ = (state[3] << 17) | (state[2] >> 15);
+      const T s70_ = (fbk0 << 26) | (state[3] >> 6);
+      const T s85_ = (fbk0 << 11) | (state[3] >> 21);
+      const T s91_ = (fbk0 << 5) | (state[3] >> 27);
+
+      // computed (next) 32 feedback bits
+      const size_t idx1 = (i + 1ul) & 7ul;
+      const T fbk1 = state[1] ^ s47_ ^ (~(s70_ & s85_)) ^ s91_ ^ key[idx1];
+
+      state[0] = state[2];
+      state[1] = state[3];
+      state[2] = fbk0;
+      state[3] = fbk1;
     }
-    {
-      const uint32_t s47 = (state[1] << 17) | (state[0] >> 15);
-      const uint32_t s70 = (state[2] << 26) | (state[1] >> 6);
-      const uint32_t s85 = (state[2] << 11) | (state[1] >> 21);
-      const uint32_t s91 = (state[2] << 5) | (state[1] >> 27);
-
-      state[3] = state[3] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 3ul) & 7ul];
+  } else if constexpr (fbk == fbk_t::fbk_all) {
+    using namespace tinyjambu_unrolled;
+    steps<8ul>(state, key, std::make_index_sequence<itr_cnt>{});
+  } else {
+    for (size_t i = 0; i < itr_cnt; i += 4) {
+      {
+        const T s47 = (state[2] << 17) | (state[1] >> 15);
+        const T s70 = (state[3] << 26) | (state[2] >> 6);
+        const T s85 = (state[3] << 11) | (state[2] >> 21);
+        const T s91 = (state[3] << 5) | (state[2] >> 27);
+
+        state[0] = state[0] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 0ul) & 7ul];
+      }
+      {
+        const T s47 = (state[3] << 17) | (state[2] >> 15);
+        const T s70 = (state[0] << 26) | (state[3] >> 6);
+        const T s85 = (state[0] << 11) | (state[3] >> 21);
+        const T s91 = (state[0] << 5) | (state[3] >> 27);
+
+        state[1] = state[1] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 1ul) & 7ul];
+      }
+      {
+        const T s47 = (state[0] << 17) | (state[3] >> 15);
+        const T s70 = (state[1] << 26) | (state[0] >> 6);
+        const T s85 = (state[1] << 11) | (state[0] >> 21);
+        const T s91 = (state[1] << 5) | (state[0] >> 27);
+
+        state[2] = state[2] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 2ul) & 7ul];
+      }
+      {
+        const T s47 = (state[1] << 17) | (state[0] >> 15);
+        const T s70 = (state[2] << 26) | (state[1] >> 6);
+        const T s85 = (state[2] << 11) | (state[1] >> 21);
+        const T s91 = (state[2] << 5) | (state[1] >> 27);
+
+        state[3] = state[3] ^ s47 ^ (~(s70 & s85)) ^ s91 ^ key[(i + 3ul) & 7ul];
+      }
     }
   }
-
-#endif
 }
 
 }
@@ -0,0 +1,273 @@
+#pragma once
+#include "key_context.hpp"
+#include "stream.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+// Lock-free TinyJambu-{128, 192, 256} AEAD pipeline stage, sitting between
+// producer ( say RX ) threads & consumer ( say TX ) threads, where any number
+// of crypto workers drain jobs in batches, while consumers receive sealed/
+// opened jobs in same order as they were produced
+namespace tinyjambu::pipeline {
+
+// Default # -of jobs claimed by a worker at once, amortizing cost of claiming
+// over many small messages
+constexpr size_t BATCH = 16;
+
+// One AEAD job, where `in` & `out` are plain & cipher text ( respectively )
+// when encrypting, while they're swapped when decrypting. Both of them must be
+// of same length. Authentication tag is written to `tag` when encrypting,
+// while it's read from there when decrypting. Nonce & tag are carried inside
+// job descriptor, while associated data, input & output buffers must stay
+// alive until job is dequeued by consumer.
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+struct job_t
+{
+  direction_t dir;                  // encrypt or decrypt ?
+  const key_context<v, fbk>* ctx;   // secret key context
+  uint8_t nonce[12];                // 96 -bit public message nonce
+  uint8_t tag[8];                   // 64 -bit authentication tag
+  std::span<const uint8_t> data;    // associated data
+  std::span<const uint8_t> in;      // plain/ cipher text
+  std::span<uint8_t> out;           // cipher/ plain text
+  bool ok;                          // set by worker, verification status
+  void* user;                       // opaque, passed through as is
+};
+
+// Bounded ring of `CAP` ( power of 2 ) preallocated job descriptors, connecting
+// many producers, many workers & many consumers, without any lock or
+// allocation on hot path.
+//
+// Each slot carries a sequence number, which tells who owns it. For i-th job (
+// counting from 0 ), its slot ( = i mod CAP ) holds sequence number
+//
+// - 3i, when it's free, so that a producer can fill it
+// - 3i + 1, when job is filled, so that a worker can process it
+// - 3i + 2, when job is processed, so that a consumer can take it
+// - 3(i + CAP), after a consumer took it, making it free for (i + CAP)-th job
+//
+// Producers reserve slots by advancing `tail_`, while workers claim ranges of
+// reserved jobs by advancing `claim_` & consumers take jobs by advancing
+// `head_`, each using compare-and-swap. Consumers only take next slot, once
+// it's processed, so jobs are dequeued in order, even when workers finish them
+// out of order. A worker may briefly wait for a claimed slot, which is
+// reserved, but not yet filled by its producer.
+template<const variant v,
+         const fbk_t fbk = DEFAULT_FBK,
+         const size_t CAP = 1024>
+class ring
+{
+private:
+  static_assert(CAP >= 2 && (CAP & (CAP - 1)) == 0,
+                "Capacity must be a power of 2");
+
+  static constexpr size_t MASK = CAP - 1;
+
+  // Sequence numbers of slot of i-th job, when it's free, filled & processed
+  static constexpr uint64_t free_seq(const uint64_t i) { return 3 * i; }
+  static constexpr uint64_t full_seq(const uint64_t i) { return 3 * i + 1; }
+  static constexpr uint64_t done_seq(const uint64_t i) { return 3 * i + 2; }
+
+  struct alignas(64) slot_t
+  {
+    std::atomic<uint64_t> seq{ 0 };
+    job_t<v, fbk> job;
+  };
+
+  std::unique_ptr<slot_t[]> slots_;
+
+  // Each counter lives on its own cache line, to avoid false sharing between
+  // producers, workers & consumers
+  alignas(64) std::atomic<uint64_t> tail_{ 0 };  // written by producers
+  alignas(64) std::atomic<uint64_t> claim_{ 0 }; // written by workers
+  alignas(64) std::atomic<uint64_t> head_{ 0 };  // written by consumers
+
+  // Encrypts/ decrypts single job, in place
+  static void process(job_t<v, fbk>& j)
+  {
+    if (j.dir == direction_t::encrypt) {
+      j.ctx->encrypt(j.nonce,
+                     j.data.data(),
+                     j.data.size(),
+                     j.in.data(),
+                     j.out.data(),
+                     j.in.size(),
+                     j.tag);
+      j.ok = true;
+    } else {
+      j.ok = j.ctx->decrypt(j.nonce,
+                            j.tag,
+                            j.data.data(),
+                            j.data.size(),
+                            j.in.data(),
+                            j.out.data(),
+                            j.in.size());
+    }
+  }
+
+public:
+  ring()
+    : slots_{ std::make_unique<slot_t[]>(CAP) }
+  {
+    for (size_t i = 0; i < CAP; i++) {
+      slots_[i].seq.store(free_seq(i), std::memory_order_relaxed);
+    }
+  }
+
+  ring(const ring&) = delete;
+  ring& operator=(const ring&) = delete;
+
+  // Copies job into next free slot & publishes it to workers, returning false
+  // if ring is full. Can be called from many producers.
+  bool try_push(const job_t<v, fbk>& job)
+  {
+    uint64_t s = tail_.load(std::memory_order_relaxed);
+
+    while (true) {
+      slot_t& slot = slots_[s & MASK];
+      const uint64_t seq = slot.seq.load(std::memory_order_acquire);
+
+      if (seq < free_seq(s)) {
+        // slot still holds job of previous lap
+        return false;
+      }
+
+      if (seq == free_seq(s)) {
+        if (tail_.compare_exchange_weak(
+              s, s + 1, std::memory_order_relaxed, std::memory_order_relaxed)) {
+          slot.job = job;
+          slot.seq.store(full_seq(s), std::memory_order_release);
+          return true;
+        }
+      } else {
+        // another producer reserved this slot
+        s = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Claims upto `max` reserved jobs & processes them, returning # -of jobs
+  // processed ( 0, if none was waiting ). Can be called from many workers.
+  size_t work(const size_t max = BATCH)
+  {
+    uint64_t c = claim_.load(std::memory_order_relaxed);
+    uint64_t n = 0;
+
+    do {
+      const uint64_t t = tail_.load(std::memory_order_acquire);
+      if (c >= t) {
+        return 0;
+      }
+      n = std::min<uint64_t>(max, t - c);
+    } while (!claim_.compare_exchange_weak(
+      c, c + n, std::memory_order_relaxed, std::memory_order_relaxed));
+
+    for (uint64_t s = c; s < c + n; s++) {
+      slot_t& slot = slots_[s & MASK];
+
+      // producer may still be filling a reserved slot
+      while (slot.seq.load(std::memory_order_acquire) != full_seq(s)) {
+        std::this_thread::yield();
+      }
+
+      process(slot.job);
+      slot.seq.store(done_seq(s), std::memory_order_release);
+    }
+
+    return n;
+  }
+
+  // Copies next job ( in production order ) into `job` & frees its slot,
+  // returning false if that job is not yet processed. Can be called from many
+  // consumers.
+  bool try_pop(job_t<v, fbk>& job)
+  {
+    uint64_t h = head_.load(std::memory_order_relaxed);
+
+    while (true) {
+      slot_t& slot = slots_[h & MASK];
+      const uint64_t seq = slot.seq.load(std::memory_order_acquire);
+
+      if (seq < done_seq(h)) {
+        // job is not yet produced or processed
+        return false;
+      }
+
+      if (seq == done_seq(h)) {
+        if (head_.compare_exchange_weak(
+              h, h + 1, std::memory_order_relaxed, std::memory_order_relaxed)) {
+          job = slot.job;
+          slot.seq.store(free_seq(h + CAP), std::memory_order_release);
+          return true;
+        }
+      } else {
+        // another consumer took this job
+        h = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // # -of job descriptors in ring
+  static constexpr size_t capacity() { return CAP; }
+};
+
+// Pipeline stage, owning a ring of job descriptors & `n` worker threads, which
+// keep draining it, `BATCH` jobs at a time, spinning ( with yield ) when no job
+// is waiting. Any number of producer & consumer threads use `try_push` &
+// `try_pop`.
+template<const variant v,
+         const fbk_t fbk = DEFAULT_FBK,
+         const size_t CAP = 1024>
+class stage
+{
+private:
+  ring<v, fbk, CAP> ring_;
+  std::atomic<bool> stop_{ false };
+  std::vector<std::thread> threads_;
+
+  void worker()
+  {
+    while (!stop_.load(std::memory_order_relaxed)) {
+      if (ring_.work(BATCH) == 0) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+public:
+  // Starts `n` ( > 0 ) worker threads
+  explicit stage(const size_t n = 1)
+  {
+    threads_.reserve(std::max<size_t>(n, 1));
+    for (size_t w = 0; w < std::max<size_t>(n, 1); w++) {
+      threads_.emplace_back(&stage::worker, this);
+    }
+  }
+
+  // Stops worker threads, jobs still in flight are abandoned
+  ~stage()
+  {
+    stop_.store(true, std::memory_order_relaxed);
+    for (std::thread& t : threads_) {
+      t.join();
+    }
+  }
+
+  stage(const stage&) = delete;
+  stage& operator=(const stage&) = delete;
+
+  // See `ring::try_push`
+  bool try_push(const job_t<v, fbk>& job) { return ring_.try_push(job); }
+
+  // See `ring::try_pop`
+  bool try_pop(job_t<v, fbk>& job) { return ring_.try_pop(job); }
+
+  // # -of worker threads
+  size_t size() const { return threads_.size(); }
+};
+
+}
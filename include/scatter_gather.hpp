@@ -0,0 +1,334 @@
+#pragma once
+#include "tinyjambu.hpp"
+#include <algorithm>
+#include <span>
+#include <type_traits>
+
+// Scatter/ gather variants of TinyJambu-{128, 192, 256} AEAD routines, where
+// associated data, plain text & cipher text are each given as a list of
+// non-contiguous byte segments ( say fragments of a network packet ), instead
+// of a single contiguous buffer, so that those need not be coalesced first
+namespace tinyjambu {
+
+// Read-only segment of bytes, holding `len` -many bytes, starting at `base`
+struct segment_t
+{
+  const uint8_t* base;
+  size_t len;
+};
+
+// Writable segment of bytes, holding `len` -many bytes, starting at `base`
+struct mut_segment_t
+{
+  uint8_t* base;
+  size_t len;
+};
+
+// List of read-only segments
+using segments_t = std::span<const segment_t>;
+
+// List of writable segments
+using mut_segments_t = std::span<const mut_segment_t>;
+
+// Total # -of bytes held by a list of segments
+template<typename S>
+static inline size_t
+total_len(const std::span<const S> segs)
+{
+  size_t len = 0;
+  for (const S& seg : segs) {
+    len += seg.len;
+  }
+  return len;
+}
+
+// Sequential cursor over a list of segments, which reads/ writes ( at most ) 4
+// -bytes at a time, as a little endian 32 -bit word, carrying a word across
+// segment boundary ( if required ), so that callers see a single contiguous
+// byte stream. Empty segments are skipped.
+template<typename S>
+class segment_cursor
+{
+private:
+  const S* seg_;
+  const S* end_;
+  size_t off_ = 0;
+
+  // Moves to next non-empty segment, if current one is fully consumed
+  inline void skip()
+  {
+    while (seg_ != end_ && off_ == seg_->len) {
+      seg_++;
+      off_ = 0;
+    }
+  }
+
+public:
+  explicit segment_cursor(const std::span<const S> segs)
+    : seg_(segs.data())
+    , end_(segs.data() + segs.size())
+  {
+    skip();
+  }
+
+  // Reads next `len` ( <= 4 ) bytes as little endian 32 -bit word
+  inline uint32_t read(const size_t len)
+  {
+    if (seg_->len - off_ >= len) {
+      const uint8_t* const ptr = seg_->base + off_;
+      const uint32_t word =
+        len == 4 ? from_le_bytes(ptr) : from_le_bytes(ptr, len);
+
+      off_ += len;
+      skip();
+      return word;
+    }
+
+    // word is split across segment boundary
+    const size_t n = std::min<size_t>(len, 4);
+
+    uint8_t tmp[4]{};
+    for (size_t i = 0; i < n; i++) {
+      tmp[i] = seg_->base[off_++];
+      skip();
+    }
+    return from_le_bytes(tmp, n);
+  }
+
+  // Writes lowest `len` ( <= 4 ) bytes of 32 -bit word, in little endian order
+  inline void write(const uint32_t word, const size_t len)
+    requires(std::is_same_v<S, mut_segment_t>)
+  {
+    if (seg_->len - off_ >= len) {
+      uint8_t* const ptr = seg_->base + off_;
+
+      if (len == 4) {
+        to_le_bytes(word, ptr);
+      } else {
+        to_le_bytes(word, ptr, len);
+      }
+
+      off_ += len;
+      skip();
+      return;
+    }
+
+    // word is split across segment boundary
+    const size_t n = std::min<size_t>(len, 4);
+
+    uint8_t tmp[4]{};
+    to_le_bytes(word, tmp);
+
+    for (size_t i = 0; i < n; i++) {
+      seg_->base[off_++] = tmp[i];
+      skip();
+    }
+  }
+};
+
+// Scatter/ gather equivalent of `process_associated_data`, where associated
+// data bytes are read from a list of segments
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+static inline void
+process_associated_data(
+  uint32_t* const __restrict state,     // 128 -bit state
+  const uint32_t* const __restrict key, // {128, 192, 256} -bit secret key
+  const segments_t data                 // associated data segments
+)
+{
+  const size_t data_len = total_len(data);
+  const size_t full_byte_cnt = data_len & (~3ul);
+  const size_t part_byte_cnt = data_len & 3ul;
+
+  segment_cursor<segment_t> rd{ data };
+
+  for (size_t b_off = 0; b_off < full_byte_cnt; b_off += 4) {
+    state[1] ^= FRAMEBITS_AD;
+
+    permute<v, 640ul, fbk>(state, key);
+
+    state[3] ^= rd.read(4);
+  }
+
+  if (part_byte_cnt > 0ul) {
+    state[1] ^= FRAMEBITS_AD;
+
+    permute<v, 640ul, fbk>(state, key);
+
+    state[3] ^= rd.read(part_byte_cnt);
+  }
+
+  state[1] ^= static_cast<uint32_t>(part_byte_cnt);
+}
+
+// Scatter/ gather equivalent of `process_plain_text`, where plain text bytes
+// are read from a list of segments & cipher text bytes are written to another
+// list of segments, which must be able to hold as many bytes as plain text
+// segments do. Both lists may describe same memory ( for in-place encryption ).
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+static inline void
+process_plain_text(
+  uint32_t* const __restrict state,     // 128 -bit state
+  const uint32_t* const __restrict key, // {128, 192, 256} -bit secret key
+  const segments_t text,                // plain text segments
+  const mut_segments_t cipher           // cipher text segments
+)
+{
+  const size_t ct_len = total_len(text);
+  const size_t full_byte_cnt = ct_len & (~3ul);
+  const size_t part_byte_cnt = ct_len & 3ul;
+
+  segment_cursor<segment_t> rd{ text };
+  segment_cursor<mut_segment_t> wr{ cipher };
+
+  for (size_t b_off = 0; b_off < full_byte_cnt; b_off += 4) {
+    state[1] ^= FRAMEBITS_CT;
+
+    permute<v, key_rounds<v>(), fbk>(state, key);
+
+    const uint32_t word = rd.read(4);
+
+    state[3] ^= word;
+    wr.write(state[2] ^ word, 4);
+  }
+
+  if (part_byte_cnt > 0ul) {
+    state[1] ^= FRAMEBITS_CT;
+
+    permute<v, key_rounds<v>(), fbk>(state, key);
+
+    const uint32_t word = rd.read(part_byte_cnt);
+
+    state[3] ^= word;
+    wr.write(state[2] ^ word, part_byte_cnt);
+  }
+
+  state[1] ^= static_cast<uint32_t>(part_byte_cnt);
+}
+
+// Scatter/ gather equivalent of `process_cipher_text`, where cipher text bytes
+// are read from a list of segments & plain text bytes are written to another
+// list of segments, which must be able to hold as many bytes as cipher text
+// segments do. Both lists may describe same memory ( for in-place decryption ).
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+static inline void
+process_cipher_text(
+  uint32_t* const __restrict state,     // 128 -bit state
+  const uint32_t* const __restrict key, // {128, 192, 256} -bit secret key
+  const segments_t cipher,              // cipher text segments
+  const mut_segments_t text             // plain text segments
+)
+{
+  const size_t ct_len = total_len(cipher);
+  const size_t full_byte_cnt = ct_len & (~3ul);
+  const size_t part_byte_cnt = ct_len & 3ul;
+
+  segment_cursor<segment_t> rd{ cipher };
+  segment_cursor<mut_segment_t> wr{ text };
+
+  for (size_t b_off = 0; b_off < full_byte_cnt; b_off += 4) {
+    state[1] ^= FRAMEBITS_CT;
+
+    permute<v, key_rounds<v>(), fbk>(state, key);
+
+    const uint32_t dec = state[2] ^ rd.read(4);
+
+    state[3] ^= dec;
+    wr.write(dec, 4);
+  }
+
+  if (part_byte_cnt > 0ul) {
+    state[1] ^= FRAMEBITS_CT;
+
+    permute<v, key_rounds<v>(), fbk>(state, key);
+
+    const uint32_t dec = state[2] ^ rd.read(part_byte_cnt);
+    const uint32_t mask = 0xffffffffu >> ((4ul - part_byte_cnt) << 3);
+
+    state[3] ^= (dec & mask);
+    wr.write(dec, part_byte_cnt);
+  }
+
+  state[1] ^= static_cast<uint32_t>(part_byte_cnt);
+}
+
+// Scatter/ gather TinyJambu-{128, 192, 256} authenticated encryption, which
+// produces same cipher text & authentication tag as contiguous `encrypt`, when
+// invoked with concatenation of associated data & plain text segments
+//
+// Note, if cipher text segments can't hold as many bytes as plain text
+// segments do, nothing is written & returned boolean is false.
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+static inline bool
+encrypt_segments(const uint8_t* const __restrict key,
+                 const uint8_t* const __restrict nonce,
+                 const segments_t data,
+                 const segments_t text,
+                 const mut_segments_t cipher,
+                 uint8_t* const __restrict tag)
+{
+  if (total_len(cipher) < total_len(text)) {
+    return false;
+  }
+
+  uint32_t state[4]{};
+  uint32_t key_[key_word_cnt<v>()];
+
+  load_key<v>(key, key_);
+
+  initialize<v, fbk>(state, key_, nonce);
+  process_associated_data<v, fbk>(state, key_, data);
+  process_plain_text<v, fbk>(state, key_, text, cipher);
+  finalize<v, fbk>(state, key_, tag);
+
+  return true;
+}
+
+// Scatter/ gather TinyJambu-{128, 192, 256} verified decryption, which produces
+// same plain text & verification flag as contiguous `decrypt`, when invoked
+// with concatenation of associated data & cipher text segments
+//
+// Note, if returned boolean verification status is not truth value, plain text
+// segments are zeroed, so don't consume them ! If plain text segments can't
+// hold as many bytes as cipher text segments do, nothing is written & false is
+// returned.
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+static inline bool
+decrypt_segments(const uint8_t* const __restrict key,
+                 const uint8_t* const __restrict nonce,
+                 const uint8_t* const __restrict tag,
+                 const segments_t data,
+                 const segments_t cipher,
+                 const mut_segments_t text)
+{
+  if (total_len(text) < total_len(cipher)) {
+    return false;
+  }
+
+  uint32_t state[4]{};
+  uint32_t key_[key_word_cnt<v>()];
+  uint8_t tag_[8]{};
+
+  load_key<v>(key, key_);
+
+  initialize<v, fbk>(state, key_, nonce);
+  process_associated_data<v, fbk>(state, key_, data);
+  process_cipher_text<v, fbk>(state, key_, cipher, text);
+  finalize<v, fbk>(state, key_, tag_);
+
+  const bool flag = mismatch(tag, tag_);
+
+  // prevent release of unverified plain text ( RUP ), only touching as many
+  // bytes as were decrypted
+  size_t left = flag * total_len(cipher);
+  for (const mut_segment_t& seg : text) {
+    const size_t n = std::min(left, seg.len);
+
+    std::memset(seg.base, 0, n);
+    left -= n;
+  }
+
+  return !flag;
+}
+
+}
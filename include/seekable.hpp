@@ -0,0 +1,303 @@
+#pragma once
+#include "chunked.hpp"
+#include <unistd.h>
+
+// Seekable encrypted container, built on chunked TinyJambu-{128, 192, 256}
+// AEAD ( see chunked.hpp ), which allows decrypting an arbitrary byte range of
+// plain text, by reading & decrypting only those chunks, which overlap with
+// it, using `pread`-style positional reads.
+//
+// Container = header ( 32 -bytes ) || chunked encrypted object
+//
+// where header is laid out as
+//
+// | bytes  | field                                              |
+// | ------ | -------------------------------------------------- |
+// | 0..4   | magic "TJSK"                                       |
+// | 4      | format version ( = 1 )                             |
+// | 5      | variant ( = 0/ 1/ 2, for TinyJambu-128/ 192/ 256 ) |
+// | 6..8   | reserved, zero                                     |
+// | 8..12  | plain text bytes per chunk, little endian          |
+// | 12..20 | plain text byte length, little endian              |
+// | 20..27 | nonce prefix of chunked encryption                 |
+// | 27..32 | reserved, zero                                     |
+//
+// Whole header is used as associated data of every chunk, so tampering with it
+// fails verification of all chunks. As all chunks ( but last ) carry same #
+// -of plain text bytes, i-th chunk is found at fixed offset, so no separate
+// index needs to be stored.
+namespace tinyjambu::seekable {
+
+// Byte length of container header
+constexpr size_t HEADER_LEN = 32;
+
+// Format version, written to header
+constexpr uint8_t VERSION = 1;
+
+// Magic bytes, identifying a container
+constexpr uint8_t MAGIC[4]{ 'T', 'J', 'S', 'K' };
+
+// Largest plain text bytes per chunk, a container may use. Reader allocates a
+// chunk sized buffer, based on header, before any chunk is verified, so this
+// bounds what a forged header can make it allocate.
+constexpr uint32_t MAX_CHUNK_LEN = 1u << 24;
+
+// Parsed container header
+struct header_t
+{
+  variant var;
+  uint32_t chunk_len;
+  uint64_t len;
+  uint8_t prefix[chunked::PREFIX_LEN];
+};
+
+// Serializes header into 32 -bytes
+inline void
+write_header(const header_t& hdr, uint8_t* const __restrict out)
+{
+  std::memset(out, 0, HEADER_LEN);
+  std::memcpy(out, MAGIC, sizeof(MAGIC));
+
+  out[4] = VERSION;
+  out[5] = static_cast<uint8_t>(hdr.var);
+
+  for (size_t i = 0; i < 4; i++) {
+    out[8 + i] = static_cast<uint8_t>(hdr.chunk_len >> (i << 3));
+  }
+  for (size_t i = 0; i < 8; i++) {
+    out[12 + i] = static_cast<uint8_t>(hdr.len >> (i << 3));
+  }
+
+  std::memcpy(out + 20, hdr.prefix, chunked::PREFIX_LEN);
+}
+
+// Parses 32 -bytes header, returning false if it's not a well-formed header
+inline bool
+read_header(const uint8_t* const __restrict in, header_t& hdr)
+{
+  if (std::memcmp(in, MAGIC, sizeof(MAGIC)) != 0 || in[4] != VERSION) {
+    return false;
+  }
+  if (in[5] > static_cast<uint8_t>(variant::key_256)) {
+    return false;
+  }
+
+  uint8_t acc = in[6] | in[7];
+  for (size_t i = 27; i < HEADER_LEN; i++) {
+    acc |= in[i];
+  }
+  if (acc != 0) {
+    return false;
+  }
+
+  hdr.var = static_cast<variant>(in[5]);
+  hdr.chunk_len = 0;
+  hdr.len = 0;
+
+  for (size_t i = 0; i < 4; i++) {
+    hdr.chunk_len |= static_cast<uint32_t>(in[8 + i]) << (i << 3);
+  }
+  for (size_t i = 0; i < 8; i++) {
+    hdr.len |= static_cast<uint64_t>(in[12 + i]) << (i << 3);
+  }
+
+  std::memcpy(hdr.prefix, in + 20, chunked::PREFIX_LEN);
+
+  return hdr.chunk_len > 0 && hdr.chunk_len <= MAX_CHUNK_LEN;
+}
+
+// Byte length of container, holding N -bytes plain text, using chunks of
+// `chunk_len` ( > 0 ) -bytes
+constexpr size_t
+container_len(const size_t len, const size_t chunk_len)
+{
+  return HEADER_LEN + chunked::sealed_len(len, chunk_len);
+}
+
+// Encrypts N -bytes plain text into a seekable container, using
+// TinyJambu-{128, 192, 256}, writing `container_len(N, chunk_len)` -bytes to
+// `out` ( say a memory mapped file ). When `pool` is given, chunks are
+// encrypted in parallel, on its workers. Returns false, without writing
+// anything, if `chunk_len` is not in [1, MAX_CHUNK_LEN] or plain text spans
+// more than 2^32 chunks ( see `chunked::encrypt` ).
+//
+// Note, a nonce prefix must never be reused under same secret key.
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+inline bool
+encrypt(const uint8_t* const __restrict key,    // secret key
+        const uint8_t* const __restrict prefix, // 7 -bytes nonce prefix
+        const uint8_t* const __restrict text,   // plain text
+        const size_t len,                       // plain text byte length
+        const uint32_t chunk_len,               // plain text bytes per chunk
+        uint8_t* const __restrict out,          // container
+        parallel::pool* const pool = nullptr    // optional worker pool
+)
+{
+  if (chunk_len == 0 || chunk_len > MAX_CHUNK_LEN) {
+    return false;
+  }
+
+  header_t hdr{ v, chunk_len, len, {} };
+  std::memcpy(hdr.prefix, prefix, chunked::PREFIX_LEN);
+
+  write_header(hdr, out);
+
+  uint8_t* const body = out + HEADER_LEN;
+  return chunked::encrypt<v, fbk>(
+    key, prefix, out, HEADER_LEN, text, len, chunk_len, body, pool);
+}
+
+// Random-access reader of a seekable container, which decrypts only those
+// chunks, overlapping with requested byte range, reading them using
+// positional reads. Memory usage is bounded by a single chunk.
+//
+// Container is read using a callable, with signature of `pread` ( sans file
+// descriptor ), i.e. ssize_t(void* buf, size_t count, off_t offset), so that
+// it can be backed by a file, memory buffer or remote object store.
+//
+// Note, header fields ( say `size()` ) are only authenticated, when some chunk
+// is read & verified.
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+class reader
+{
+private:
+  uint8_t key_[key_word_cnt<v>() << 2];
+  uint8_t raw_hdr_[HEADER_LEN];
+  header_t hdr_{};
+  bool valid_ = false;
+
+  std::function<ssize_t(void*, size_t, off_t)> src_;
+  std::vector<uint8_t> buf_;
+
+  // Reads exactly `count` -bytes at `offset` of container
+  bool read_exact(uint8_t* const dst, const size_t count, const off_t offset)
+  {
+    size_t done = 0;
+
+    while (done < count) {
+      const ssize_t n = src_(dst + done, count - done, offset + done);
+      if (n <= 0) {
+        return false;
+      }
+      done += static_cast<size_t>(n);
+    }
+    return true;
+  }
+
+  // Reads & decrypts i-th chunk's plain text into `dst`, returning false if
+  // chunk can't be read or isn't authentic
+  bool read_chunk(const uint64_t idx, uint8_t* const dst)
+  {
+    const uint64_t n = chunked::chunk_cnt(hdr_.len, hdr_.chunk_len);
+    const uint64_t off = idx * hdr_.chunk_len;
+    const size_t clen = std::min<uint64_t>(hdr_.chunk_len, hdr_.len - off);
+    const off_t pos = HEADER_LEN + idx * (hdr_.chunk_len + chunked::TAG_LEN);
+
+    uint8_t tag[chunked::TAG_LEN];
+    uint8_t nonce[12];
+
+    if (!read_exact(dst, clen, pos) ||
+        !read_exact(tag, chunked::TAG_LEN, pos + clen)) {
+      return false;
+    }
+
+    chunked::chunk_nonce(hdr_.prefix, idx, idx == n - 1, nonce);
+
+    const parallel::job_t job{
+      key_, nonce, { raw_hdr_, HEADER_LEN }, { dst, clen }, { dst, clen }, tag
+    };
+
+    return parallel::decrypt_job<v, fbk>(job);
+  }
+
+public:
+  // Opens container, reading its header using `src`, which is to be checked
+  // using `valid()`, before reading anything
+  reader(const uint8_t* const __restrict key,
+         std::function<ssize_t(void*, size_t, off_t)> src)
+    : src_{ std::move(src) }
+  {
+    std::memcpy(key_, key, sizeof(key_));
+
+    valid_ = read_exact(raw_hdr_, HEADER_LEN, 0) &&
+             read_header(raw_hdr_, hdr_) && hdr_.var == v &&
+             chunked::chunk_cnt(hdr_.len, hdr_.chunk_len) - 1 <=
+               std::numeric_limits<uint32_t>::max();
+  }
+
+  // Opens container, stored in file, referred to by file descriptor `fd`
+  reader(const uint8_t* const __restrict key, const int fd)
+    : reader(key, [fd](void* buf, size_t count, off_t offset) {
+      return ::pread(fd, buf, count, offset);
+    })
+  {
+  }
+
+  // Zeroes copy of secret key & last partially requested chunk's plain text,
+  // so that they don't outlive this reader ( see `key_context` )
+  ~reader()
+  {
+    wipe(key_, sizeof(key_));
+    if (!buf_.empty()) {
+      wipe(buf_.data(), buf_.size());
+    }
+    asm volatile("" : : "r"(key_), "r"(buf_.data()) : "memory");
+  }
+
+  // Whether container header was read & it's well-formed
+  bool valid() const { return valid_; }
+
+  // Byte length of plain text, carried by container
+  uint64_t size() const { return hdr_.len; }
+
+  // Plain text bytes per chunk
+  uint32_t chunk_len() const { return hdr_.chunk_len; }
+
+  // Decrypts `len` -bytes of plain text, starting at byte offset `off`,
+  // writing them to `out`, by reading & decrypting only those chunks, which
+  // overlap with requested range. Chunks fully covered by requested range are
+  // decrypted right into `out`, while partially covered ones ( at most two )
+  // are decrypted into internal buffer, before copying requested bytes.
+  // Returns false, if requested range is out of bounds, some chunk can't be
+  // read or isn't authentic.
+  //
+  // Note, if returned boolean status is not truth value, `len` -bytes of `out`
+  // are zeroed, so don't consume them !
+  bool read(uint8_t* const __restrict out, const size_t len, const uint64_t off)
+  {
+    bool flag = valid_ && off <= hdr_.len && len <= hdr_.len - off;
+
+    const uint64_t cl = hdr_.chunk_len;
+    uint64_t pos = off;
+
+    while (flag && pos < off + len) {
+      const uint64_t idx = pos / cl;
+      const uint64_t beg = idx * cl;
+      const uint64_t end = std::min(beg + cl, hdr_.len);
+      const uint64_t upto = std::min(end, off + len);
+
+      uint8_t* const dst = out + (pos - off);
+
+      if (pos == beg && upto == end) {
+        // whole chunk is requested, decrypt it right into output
+        flag = read_chunk(idx, dst);
+      } else {
+        // sized on first use, no chunk is longer than whole plain text
+        if (buf_.empty()) {
+          buf_.resize(std::min<uint64_t>(hdr_.chunk_len, hdr_.len));
+        }
+
+        flag = read_chunk(idx, buf_.data());
+        std::memcpy(dst, buf_.data() + (pos - beg), upto - pos);
+      }
+
+      pos = upto;
+    }
+
+    // prevent release of unverified plain text ( RUP )
+    std::memset(out, 0, !flag * len);
+    return flag;
+  }
+};
+
+}
@@ -0,0 +1,227 @@
+#pragma once
+#include "tinyjambu.hpp"
+#include <cassert>
+
+// Incremental ( streaming ) TinyJambu-{128, 192, 256} AEAD, where associated
+// data & plain/ cipher text are fed in arbitrary sized pieces, while keeping
+// memory usage constant, no matter how long the message is
+namespace tinyjambu {
+
+// Whether a stream encrypts plain text or decrypts cipher text
+enum class direction_t : uint8_t
+{
+  encrypt,
+  decrypt,
+};
+
+// Streaming TinyJambu-{128, 192, 256} authenticated encryption/ verified
+// decryption, which wraps `initialize`, `process_associated_data`, `process_{
+// plain, cipher}_text` & `finalize`, carrying partially filled 32 -bit word (
+// if any ) between calls, so that output is same as what one-shot `encrypt`/
+// `decrypt` produces, when invoked with concatenation of all pieces.
+//
+// Usage: construct with secret key & nonce, call `update_ad` zero or more
+// times, then call `update` zero or more times, finally call `finalize` ( when
+// encrypting ) to get 64 -bit authentication tag or `verify` ( when decrypting
+// ) to check it. Each call to `update` produces as many output bytes as it's
+// given, input & output may point to same memory.
+//
+// Note, when decrypting, plain text is released before authentication tag is
+// verified, so don't act on it until `verify` returns truth value ! Calling
+// `update_ad` after `update`, or anything after `finalize`/ `verify`, trips an
+// assertion, in debug builds.
+template<const variant v,
+         const direction_t d = direction_t::encrypt,
+         const fbk_t fbk = DEFAULT_FBK>
+class stream
+{
+private:
+  uint32_t key_[key_word_cnt<v>()];
+  uint32_t state_[4]{};
+
+  // partially filled word ( little endian ), holding `part_` -many bytes
+  uint32_t word_ = 0;
+  size_t part_ = 0;
+
+  // whether all associated data has been absorbed
+  bool ad_done_ = false;
+
+  // whether authentication tag has been computed, after which stream can't be
+  // used anymore
+  bool finalized_ = false;
+
+  // Absorbs one ( possibly partial ) 32 -bit word of associated data
+  inline void absorb_ad(const uint32_t word)
+  {
+    state_[1] ^= FRAMEBITS_AD;
+    permute<v, 640ul, fbk>(state_, key_);
+    state_[3] ^= word;
+  }
+
+  // Absorbs remaining partial word of associated data ( if any ), switching to
+  // plain/ cipher text processing
+  inline void finish_ad()
+  {
+    if (ad_done_) {
+      return;
+    }
+
+    if (part_ > 0) {
+      absorb_ad(word_);
+    }
+    state_[1] ^= static_cast<uint32_t>(part_);
+
+    word_ = 0;
+    part_ = 0;
+    ad_done_ = true;
+  }
+
+  // Mixes remaining partial word of plain text ( if any ) into state & computes
+  // 64 -bit authentication tag
+  inline void compute_tag(uint8_t* const __restrict tag)
+  {
+    assert(!finalized_);
+
+    finish_ad();
+
+    state_[3] ^= word_;
+    state_[1] ^= static_cast<uint32_t>(part_);
+
+    tinyjambu::finalize<v, fbk>(state_, key_, tag);
+    finalized_ = true;
+  }
+
+public:
+  // Initializes stream from {16, 24, 32} -bytes secret key & 12 -bytes nonce
+  stream(const uint8_t* const __restrict key,
+         const uint8_t* const __restrict nonce)
+  {
+    load_key<v>(key, key_);
+    initialize<v, fbk>(state_, key_, nonce);
+  }
+
+  // Zeroes secret key words, key dependent state & carried plain text word,
+  // so that they don't outlive this stream ( see `key_context` )
+  ~stream()
+  {
+    wipe(reinterpret_cast<uint8_t*>(key_), sizeof(key_));
+    wipe(reinterpret_cast<uint8_t*>(state_), sizeof(state_));
+    wipe(reinterpret_cast<uint8_t*>(&word_), sizeof(word_));
+    asm volatile("" : : "r"(key_), "r"(state_), "r"(&word_) : "memory");
+  }
+
+  // Absorbs next `len` -bytes of associated data, which must be invoked before
+  // any call to `update`
+  inline void update_ad(const uint8_t* const __restrict data, const size_t len)
+  {
+    // late associated data would be mixed into plain text carry word
+    assert(!ad_done_);
+
+    size_t off = 0;
+
+    // complete partially filled word, carried from previous call
+    while (part_ > 0 && off < len) {
+      word_ |= static_cast<uint32_t>(data[off++]) << (part_ << 3);
+
+      if (++part_ == 4) {
+        absorb_ad(word_);
+
+        word_ = 0;
+        part_ = 0;
+      }
+    }
+
+    // full 32 -bit words
+    for (; off + 4 <= len; off += 4) {
+      absorb_ad(from_le_bytes(data + off));
+    }
+
+    // remaining bytes are carried to next call
+    while (off < len) {
+      word_ |= static_cast<uint32_t>(data[off++]) << (part_ << 3);
+      part_++;
+    }
+  }
+
+  // Encrypts ( or decrypts, based on direction of stream ) next `len` -bytes
+  // of input, writing `len` -bytes of output
+  inline void update(const uint8_t* const in, // plain/ cipher text
+                     uint8_t* const out,       // cipher/ plain text
+                     const size_t len          // byte length of input
+  )
+  {
+    assert(!finalized_);
+
+    finish_ad();
+
+    size_t off = 0;
+
+    while (off < len) {
+      // start of a new word, compute its key stream
+      if (part_ == 0) {
+        // full 32 -bit words, processed same way as `process_*_text`
+        for (; off + 4 <= len; off += 4) {
+          state_[1] ^= FRAMEBITS_CT;
+          permute<v, key_rounds<v>(), fbk>(state_, key_);
+
+          const uint32_t word = from_le_bytes(in + off);
+          const uint32_t res = state_[2] ^ word;
+
+          if constexpr (d == direction_t::encrypt) {
+            state_[3] ^= word;
+          } else {
+            state_[3] ^= res;
+          }
+          to_le_bytes(res, out + off);
+        }
+
+        if (off == len) {
+          break;
+        }
+
+        state_[1] ^= FRAMEBITS_CT;
+        permute<v, key_rounds<v>(), fbk>(state_, key_);
+      }
+
+      // byte by byte, until current word is filled or input is exhausted,
+      // where key stream word is state[2], which is not touched until next
+      // permutation
+      const uint8_t ks = static_cast<uint8_t>(state_[2] >> (part_ << 3));
+      const uint8_t ib = in[off];
+      const uint8_t ob = ib ^ ks;
+
+      out[off++] = ob;
+
+      // plain text byte is absorbed
+      const uint8_t pb = d == direction_t::encrypt ? ib : ob;
+      word_ |= static_cast<uint32_t>(pb) << (part_ << 3);
+
+      if (++part_ == 4) {
+        state_[3] ^= word_;
+
+        word_ = 0;
+        part_ = 0;
+      }
+    }
+  }
+
+  // Finishes encryption, computing 64 -bit authentication tag
+  inline void finalize(uint8_t* const __restrict tag)
+    requires(d == direction_t::encrypt)
+  {
+    compute_tag(tag);
+  }
+
+  // Finishes decryption, returning truth value only if computed authentication
+  // tag matches with given 64 -bit tag
+  inline bool verify(const uint8_t* const __restrict tag)
+    requires(d == direction_t::decrypt)
+  {
+    uint8_t tag_[8]{};
+
+    compute_tag(tag_);
+    return !mismatch(tag, tag_);
+  }
+};
+
+}
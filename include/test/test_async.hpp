@@ -0,0 +1,285 @@
+#pragma once
+#include "async.hpp"
+#include "test_common.hpp"
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Single threaded run queue, resuming suspended coroutines in FIFO order, as an
+// event loop would do
+struct run_queue
+{
+  std::deque<std::coroutine_handle<>> q;
+  size_t resumed = 0;
+
+  static void post(void* ctx, std::coroutine_handle<> h)
+  {
+    static_cast<run_queue*>(ctx)->q.push_back(h);
+  }
+
+  tinyjambu::executor_t executor() { return { &run_queue::post, this }; }
+
+  // Resumes queued coroutines, until none is left
+  void drain()
+  {
+    while (!q.empty()) {
+      std::coroutine_handle<> h = q.front();
+      q.pop_front();
+
+      resumed++;
+      h.resume();
+    }
+  }
+};
+
+// Single worker thread, resuming coroutines posted to it, from any thread
+class offload_thread
+{
+private:
+  std::mutex m_;
+  std::condition_variable cv_;
+  std::deque<std::coroutine_handle<>> q_;
+  bool stop_ = false;
+  std::thread t_;
+
+  void run()
+  {
+    while (true) {
+      std::coroutine_handle<> h;
+      {
+        std::unique_lock<std::mutex> lk{ m_ };
+        cv_.wait(lk, [&] { return stop_ || !q_.empty(); });
+
+        if (q_.empty()) {
+          return;
+        }
+        h = q_.front();
+        q_.pop_front();
+      }
+      h.resume();
+    }
+  }
+
+  static void post(void* ctx, std::coroutine_handle<> h)
+  {
+    offload_thread* const self = static_cast<offload_thread*>(ctx);
+    {
+      std::lock_guard<std::mutex> lk{ self->m_ };
+      self->q_.push_back(h);
+    }
+    self->cv_.notify_one();
+  }
+
+public:
+  offload_thread()
+    : t_{ &offload_thread::run, this }
+  {
+  }
+
+  ~offload_thread()
+  {
+    {
+      std::lock_guard<std::mutex> lk{ m_ };
+      stop_ = true;
+    }
+    cv_.notify_one();
+    t_.join();
+  }
+
+  tinyjambu::executor_t executor() { return { &offload_thread::post, this }; }
+};
+
+// Encrypts & then decrypts, awaiting both coroutines one after another
+template<const tinyjambu::variant v>
+tinyjambu::task<bool>
+async_roundtrip(const uint8_t* const key,
+                const uint8_t* const nonce,
+                const uint8_t* const data,
+                const size_t dt_len,
+                const uint8_t* const text,
+                uint8_t* const enc,
+                uint8_t* const dec,
+                const size_t ct_len,
+                uint8_t* const tag,
+                const tinyjambu::executor_t exec,
+                const size_t slice)
+{
+  using namespace tinyjambu;
+
+  co_await async_encrypt<v>(
+    key, nonce, data, dt_len, text, enc, ct_len, tag, exec, slice);
+  co_return co_await async_decrypt<v>(
+    key, nonce, tag, data, dt_len, enc, dec, ct_len, exec, slice);
+}
+
+// Test coroutine based TinyJambu-{128, 192, 256} AEAD, by running a few
+// messages concurrently on a single threaded run queue, in slices of
+// `slice` -bytes, which must suspend once per slice & produce same cipher text
+// & authentication tag as one-shot `encrypt`. Decrypting them ( as well as a
+// message with mutated tag ) must produce same plain text & verification flag
+// as one-shot `decrypt`. Also a message is encrypted & decrypted by a
+// coroutine, awaiting both, on an offload thread, as well as without executor.
+template<const tinyjambu::variant v>
+void
+async(const size_t dt_len, const size_t ct_len, const size_t slice)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+  constexpr size_t msg_cnt = 3;
+
+  std::vector<uint8_t> key(klen), nonce(12), data(dt_len);
+  std::vector<uint8_t> text(ct_len * msg_cnt), enc(ct_len * msg_cnt);
+  std::vector<uint8_t> enc_(ct_len * msg_cnt), dec(ct_len * msg_cnt);
+  std::vector<uint8_t> tag(8 * msg_cnt), tag_(8 * msg_cnt);
+
+  random_data(key.data(), klen);
+  random_data(nonce.data(), 12);
+  random_data(data.data(), dt_len);
+  random_data(text.data(), text.size());
+
+  const uint8_t* const k = key.data();
+  const uint8_t* const n = nonce.data();
+  const uint8_t* const d = data.data();
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    const uint8_t* const txt = text.data() + i * ct_len;
+    uint8_t* const ctxt = enc.data() + i * ct_len;
+
+    aead_encrypt<v>(k, n, d, dt_len, txt, ctxt, ct_len, tag.data() + i * 8);
+  }
+
+  // # -of slices, processed by a coroutine, for one message
+  const size_t slices = std::max<size_t>(1,
+                                         (dt_len + slice - 1) / slice +
+                                           (ct_len + slice - 1) / slice);
+
+  run_queue rq;
+
+  {
+    std::vector<task<void>> tasks;
+    for (size_t i = 0; i < msg_cnt; i++) {
+      const size_t off = i * ct_len;
+      tasks.push_back(async_encrypt<v>(k,
+                                       n,
+                                       d,
+                                       dt_len,
+                                       text.data() + off,
+                                       enc_.data() + off,
+                                       ct_len,
+                                       &tag_[i * 8],
+                                       rq.executor(),
+                                       slice));
+    }
+
+    for (task<void>& t : tasks) {
+      t.start();
+      assert(!t.done());
+    }
+    rq.drain();
+
+    for (task<void>& t : tasks) {
+      assert(t.done());
+    }
+    assert(rq.resumed == msg_cnt * slices);
+  }
+
+  assert(enc == enc_);
+  assert(tag == tag_);
+
+  // last message's tag is mutated, which must fail verification
+  tag_[tag_.size() - 1] ^= static_cast<uint8_t>(1);
+  rq.resumed = 0;
+
+  {
+    std::vector<task<bool>> tasks;
+    for (size_t i = 0; i < msg_cnt; i++) {
+      const size_t off = i * ct_len;
+      tasks.push_back(async_decrypt<v>(k,
+                                       n,
+                                       &tag_[i * 8],
+                                       d,
+                                       dt_len,
+                                       enc_.data() + off,
+                                       dec.data() + off,
+                                       ct_len,
+                                       rq.executor(),
+                                       slice));
+    }
+
+    for (task<bool>& t : tasks) {
+      t.start();
+    }
+    rq.drain();
+
+    for (size_t i = 0; i < msg_cnt; i++) {
+      assert(tasks[i].done());
+      assert(tasks[i].result() == (i + 1 < msg_cnt));
+    }
+    assert(rq.resumed == msg_cnt * slices);
+  }
+
+  const size_t last = (msg_cnt - 1) * ct_len;
+  assert(std::equal(dec.begin(), dec.begin() + last, text.begin()));
+  if (ct_len > 0) {
+    assert(is_zeros(dec.data() + last, ct_len));
+  }
+
+  // awaited from another coroutine, resumed on an offload thread
+  {
+    std::vector<uint8_t> enc0(ct_len), dec0(ct_len), tag0(8);
+    offload_thread ot;
+
+    task<bool> t = async_roundtrip<v>(k,
+                                      n,
+                                      d,
+                                      dt_len,
+                                      text.data(),
+                                      enc0.data(),
+                                      dec0.data(),
+                                      ct_len,
+                                      tag0.data(),
+                                      ot.executor(),
+                                      slice);
+    t.start();
+    while (!t.done()) {
+      std::this_thread::yield();
+    }
+
+    assert(t.result());
+    assert(std::equal(enc0.begin(), enc0.end(), enc.begin()));
+    assert(std::equal(tag0.begin(), tag0.end(), tag.begin()));
+    assert(std::equal(dec0.begin(), dec0.end(), text.begin()));
+  }
+
+  // without executor, coroutine never suspends
+  {
+    std::vector<uint8_t> enc0(ct_len), dec0(ct_len), tag0(8);
+
+    task<bool> t = async_roundtrip<v>(k,
+                                      n,
+                                      d,
+                                      dt_len,
+                                      text.data(),
+                                      enc0.data(),
+                                      dec0.data(),
+                                      ct_len,
+                                      tag0.data(),
+                                      {},
+                                      slice);
+    t.start();
+
+    assert(t.done());
+    assert(t.result());
+    assert(std::equal(enc0.begin(), enc0.end(), enc.begin()));
+    assert(std::equal(dec0.begin(), dec0.end(), text.begin()));
+  }
+}
+
+}
@@ -0,0 +1,220 @@
+#pragma once
+#include "chunked.hpp"
+#include "test_common.hpp"
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Test chunked TinyJambu-{128, 192, 256} AEAD, by encrypting N -bytes plain
+// text, using chunks of `chunk_len` -bytes, both sequentially & on a worker
+// pool, which must produce same encrypted object, whose first chunk must be
+// same as what `seal` computes under derived nonce, as well as what
+// `encrypt_chunks` computes, when invoked on segments of ( at most ) two
+// chunks, while a segment running past chunk index 2^32 - 1 or one, which
+// can't be decrypted ( say empty last segment ), must be rejected.
+// Then decrypting it ( again both ways, as well as segment by segment )
+// must restore plain text, while decrypting truncated ( by one chunk or by one
+// byte ), reordered ( first two chunks swapped ), extended ( by one chunk ) or
+// tampered ( single bit flip ) encrypted object must fail verification & zero
+// plain text.
+template<const tinyjambu::variant v>
+void
+chunked(tinyjambu::parallel::pool& pool,
+        const size_t dt_len,
+        const size_t ct_len,
+        const size_t chunk_len)
+{
+  using namespace tinyjambu;
+  using namespace tinyjambu::chunked;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  const size_t slen = sealed_len(ct_len, chunk_len);
+  const size_t full = chunk_len + TAG_LEN;
+  const size_t n = chunk_cnt(ct_len, chunk_len);
+
+  std::vector<uint8_t> key(klen), prefix(PREFIX_LEN), data(dt_len);
+  std::vector<uint8_t> text(ct_len), dec(ct_len);
+  std::vector<uint8_t> enc(slen), enc_(slen);
+
+  random_data(key.data(), klen);
+  random_data(prefix.data(), PREFIX_LEN);
+  random_data(data.data(), dt_len);
+  random_data(text.data(), ct_len);
+
+  const uint8_t* const k = key.data();
+  const uint8_t* const p = prefix.data();
+  const uint8_t* const d = data.data();
+
+  encrypt<v>(k, p, d, dt_len, text.data(), ct_len, chunk_len, enc.data());
+  encrypt<v>(
+    k, p, d, dt_len, text.data(), ct_len, chunk_len, enc_.data(), &pool);
+
+  assert(enc == enc_);
+
+  {
+    const size_t clen = std::min(ct_len, chunk_len);
+
+    uint8_t nonce[12];
+    std::vector<uint8_t> first(clen + TAG_LEN);
+
+    chunk_nonce(p, 0, n == 1, nonce);
+    uint8_t* const tag = first.data() + clen;
+
+    aead_encrypt<v>(k, nonce, d, dt_len, text.data(), first.data(), clen, tag);
+
+    assert(std::equal(first.begin(), first.end(), enc.begin()));
+  }
+
+  {
+    // segments of two chunks, where only final one is last segment
+    const size_t seg = 2 * chunk_len;
+
+    std::fill(enc_.begin(), enc_.end(), 0);
+    std::fill(dec.begin(), dec.end(), 0);
+
+    for (size_t i = 0, off = 0; i < n; i += 2, off += seg) {
+      const bool last = i + 2 >= n;
+      const size_t clen = last ? ct_len - off : seg;
+      const size_t elen = sealed_len(clen, chunk_len);
+
+      uint8_t* const out = enc_.data() + i * full;
+      const bool e = encrypt_chunks<v>(
+        k, p, d, dt_len, i, text.data() + off, clen, chunk_len, last, out);
+      assert(e);
+
+      const bool f = decrypt_chunks<v>(
+        k, p, d, dt_len, i, out, elen, chunk_len, last, dec.data() + off);
+      assert(f);
+
+      // non-last segment, decrypted as last one, must fail
+      if (!last) {
+        std::vector<uint8_t> tmp(clen);
+        assert(!decrypt_chunks<v>(
+          k, p, d, dt_len, i, out, elen, chunk_len, true, tmp.data(), &pool));
+      }
+    }
+
+    assert(enc == enc_);
+    assert(dec == text);
+
+    // segments, which `decrypt_chunks` would reject, must not be encrypted
+    // either, i.e. empty last segment, following a non-last one, & non-last
+    // segment, which isn't a non-zero multiple of chunk length
+    std::vector<uint8_t> out(slen, 0xa5);
+
+    assert(!encrypt_chunks<v>(
+      k, p, d, dt_len, n, text.data(), 0, chunk_len, true, out.data()));
+    assert(!encrypt_chunks<v>(
+      k, p, d, dt_len, 0, text.data(), 0, chunk_len, false, out.data()));
+    if (ct_len % chunk_len != 0) {
+      const uint8_t* const t = text.data();
+      assert(!encrypt_chunks<v>(
+        k, p, d, dt_len, 0, t, ct_len, chunk_len, false, out.data()));
+    }
+    assert(std::all_of(
+      out.begin(), out.end(), [](const uint8_t b) { return b == 0xa5; }));
+  }
+
+  {
+    // segment, whose chunk indices don't fit in 32 -bit, must be rejected,
+    // without writing anything, because chunk nonces would repeat
+    constexpr uint64_t last_idx = std::numeric_limits<uint32_t>::max();
+
+    std::vector<uint8_t> out(slen, 0xa5);
+
+    const bool e = encrypt_chunks<v>(k,
+                                     p,
+                                     d,
+                                     dt_len,
+                                     last_idx - n + 2,
+                                     text.data(),
+                                     ct_len,
+                                     chunk_len,
+                                     true,
+                                     out.data());
+    assert(!e);
+    assert(std::all_of(
+      out.begin(), out.end(), [](const uint8_t b) { return b == 0xa5; }));
+
+    // empty object is only a single chunk, at index 0
+    const bool f = encrypt_chunks<v>(k,
+                                     p,
+                                     d,
+                                     dt_len,
+                                     last_idx - n + 1,
+                                     text.data(),
+                                     ct_len,
+                                     chunk_len,
+                                     true,
+                                     out.data());
+    assert(f == (ct_len > 0));
+  }
+
+  size_t len = 0;
+  assert(opened_len(slen, chunk_len, len));
+  assert(len == ct_len);
+
+  bool f = decrypt<v>(k, p, d, dt_len, enc.data(), slen, chunk_len, dec.data());
+  assert(f);
+  assert(dec == text);
+
+  std::fill(dec.begin(), dec.end(), 0);
+  f = decrypt<v>(
+    k, p, d, dt_len, enc.data(), slen, chunk_len, dec.data(), &pool);
+  assert(f);
+  assert(dec == text);
+
+  // decrypts mutated encrypted object, which must fail & zero plain text
+  auto must_fail = [&](const std::vector<uint8_t>& bad) {
+    std::vector<uint8_t> out(bad.size(), 0xff);
+
+    // invalid encrypted object length must also fail
+    size_t len_ = 0;
+    opened_len(bad.size(), chunk_len, len_);
+
+    const bool f0 = decrypt<v>(
+      k, p, d, dt_len, bad.data(), bad.size(), chunk_len, out.data());
+    assert(!f0);
+    if (len_ > 0) {
+      assert(is_zeros(out.data(), len_));
+    }
+
+    const bool f1 = decrypt<v>(
+      k, p, d, dt_len, bad.data(), bad.size(), chunk_len, out.data(), &pool);
+    assert(!f1);
+  };
+
+  if (n > 1) {
+    // truncated by one chunk
+    must_fail(std::vector<uint8_t>(enc.begin(), enc.begin() + (n - 1) * full));
+
+    // first two chunks swapped
+    std::vector<uint8_t> bad(enc);
+    if (ct_len >= 2 * chunk_len) {
+      std::swap_ranges(bad.begin(), bad.begin() + full, bad.begin() + full);
+      must_fail(bad);
+    }
+  }
+
+  // truncated by one byte
+  must_fail(std::vector<uint8_t>(enc.begin(), enc.end() - 1));
+
+  // extended by one chunk
+  {
+    std::vector<uint8_t> bad(enc);
+    bad.insert(bad.end(), enc.begin(), enc.begin() + std::min(full, slen));
+    must_fail(bad);
+  }
+
+  // tampered
+  {
+    std::vector<uint8_t> bad(enc);
+    bad[slen / 2] ^= static_cast<uint8_t>(1);
+    must_fail(bad);
+  }
+}
+
+}
@@ -1,4 +1,7 @@
 #pragma once
+#include "tinyjambu_128.hpp"
+#include "tinyjambu_192.hpp"
+#include "tinyjambu_256.hpp"
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -8,7 +11,12 @@ namespace test_tinyjambu {
 
 // Choose which one to modify ( just a single bit flip ), before attempting
 // decryption, to show that TinyJambu-{128, 192, 256} AEAD provides promised
-// security properties
+// security properties.
+//
+// Tests of other decryption routines reuse `tag` mutation: decrypting with
+// mutated tag must fail verification & zero plain text ( i.e. unverified plain
+// text is never released ), which their comments refer to as "mutated tag
+// check".
 enum class mutate_t : uint8_t
 {
   key,   // secret key
@@ -33,4 +41,311 @@ is_zeros(const uint8_t* const bytes, const size_t blen)
   return flg;
 }
 
+// One-shot TinyJambu-{128, 192, 256} authenticated encryption, picking
+// variant & feedback bit width at compile-time, so that tests can be written
+// once for all variants
+template<const tinyjambu::variant v, const fbk_t fbk = DEFAULT_FBK>
+inline void
+aead_encrypt(const uint8_t* const __restrict key,
+             const uint8_t* const __restrict nonce,
+             const uint8_t* const __restrict data,
+             const size_t data_len,
+             const uint8_t* const __restrict text,
+             uint8_t* const __restrict cipher,
+             const size_t ct_len,
+             uint8_t* const __restrict tag)
+{
+  using namespace tinyjambu;
+
+  if constexpr (v == variant::key_128) {
+    tinyjambu_128::encrypt<fbk>(
+      key, nonce, data, data_len, text, cipher, ct_len, tag);
+  } else if constexpr (v == variant::key_192) {
+    tinyjambu_192::encrypt<fbk>(
+      key, nonce, data, data_len, text, cipher, ct_len, tag);
+  } else {
+    tinyjambu_256::encrypt<fbk>(
+      key, nonce, data, data_len, text, cipher, ct_len, tag);
+  }
+}
+
+// One-shot TinyJambu-{128, 192, 256} verified decryption, picking variant &
+// feedback bit width at compile-time, so that tests can be written once for
+// all variants
+template<const tinyjambu::variant v, const fbk_t fbk = DEFAULT_FBK>
+inline bool
+aead_decrypt(const uint8_t* const __restrict key,
+             const uint8_t* const __restrict nonce,
+             const uint8_t* const __restrict tag,
+             const uint8_t* const __restrict data,
+             const size_t data_len,
+             const uint8_t* const __restrict cipher,
+             uint8_t* const __restrict text,
+             const size_t ct_len)
+{
+  using namespace tinyjambu;
+
+  if constexpr (v == variant::key_128) {
+    return tinyjambu_128::decrypt<fbk>(
+      key, nonce, tag, data, data_len, cipher, text, ct_len);
+  } else if constexpr (v == variant::key_192) {
+    return tinyjambu_192::decrypt<fbk>(
+      key, nonce, tag, data, data_len, cipher, text, ct_len);
+  } else {
+    return tinyjambu_256::decrypt<fbk>(
+      key, nonce, tag, data, data_len, cipher, text, ct_len);
+  }
+}
+
+// Verify-only TinyJambu-{128, 192, 256} decryption, picking variant &
+// feedback bit width at compile-time
+template<const tinyjambu::variant v, const fbk_t fbk = DEFAULT_FBK>
+inline bool
+aead_verify(const uint8_t* const __restrict key,
+            const uint8_t* const __restrict nonce,
+            const uint8_t* const __restrict tag,
+            const uint8_t* const __restrict data,
+            const size_t data_len,
+            const uint8_t* const __restrict cipher,
+            const size_t ct_len)
+{
+  using namespace tinyjambu;
+
+  if constexpr (v == variant::key_128) {
+    return tinyjambu_128::verify<fbk>(
+      key, nonce, tag, data, data_len, cipher, ct_len);
+  } else if constexpr (v == variant::key_192) {
+    return tinyjambu_192::verify<fbk>(
+      key, nonce, tag, data, data_len, cipher, ct_len);
+  } else {
+    return tinyjambu_256::verify<fbk>(
+      key, nonce, tag, data, data_len, cipher, ct_len);
+  }
+}
+
+// TinyJambu-{128, 192, 256} sealing, picking variant & feedback bit width at
+// compile-time
+template<const tinyjambu::variant v, const fbk_t fbk = DEFAULT_FBK>
+inline constexpr void
+aead_seal(const uint8_t* const __restrict key,
+          const uint8_t* const __restrict nonce,
+          const uint8_t* const __restrict data,
+          const size_t data_len,
+          const uint8_t* const text,
+          const size_t ct_len,
+          uint8_t* const sealed)
+{
+  using namespace tinyjambu;
+
+  if constexpr (v == variant::key_128) {
+    tinyjambu_128::seal<fbk>(key, nonce, data, data_len, text, ct_len, sealed);
+  } else if constexpr (v == variant::key_192) {
+    tinyjambu_192::seal<fbk>(key, nonce, data, data_len, text, ct_len, sealed);
+  } else {
+    tinyjambu_256::seal<fbk>(key, nonce, data, data_len, text, ct_len, sealed);
+  }
+}
+
+// TinyJambu-{128, 192, 256} opening, picking variant & feedback bit width at
+// compile-time
+template<const tinyjambu::variant v, const fbk_t fbk = DEFAULT_FBK>
+inline constexpr bool
+aead_open(const uint8_t* const __restrict key,
+          const uint8_t* const __restrict nonce,
+          const uint8_t* const __restrict data,
+          const size_t data_len,
+          const uint8_t* const sealed,
+          const size_t sealed_len,
+          uint8_t* const text)
+{
+  using namespace tinyjambu;
+
+  if constexpr (v == variant::key_128) {
+    return tinyjambu_128::open<fbk>(
+      key, nonce, data, data_len, sealed, sealed_len, text);
+  } else if constexpr (v == variant::key_192) {
+    return tinyjambu_192::open<fbk>(
+      key, nonce, data, data_len, sealed, sealed_len, text);
+  } else {
+    return tinyjambu_256::open<fbk>(
+      key, nonce, data, data_len, sealed, sealed_len, text);
+  }
+}
+
+// Structure-of-arrays TinyJambu-{128, 192, 256} authenticated encryption of
+// fixed-size records, picking variant & feedback bit width at compile-time
+template<const tinyjambu::variant v, const fbk_t fbk = DEFAULT_FBK>
+inline void
+aead_encrypt_soa(const uint8_t* const __restrict key,
+                 const uint8_t* const __restrict nonce,
+                 const uint8_t* const __restrict data,
+                 const size_t data_stride,
+                 const size_t data_len,
+                 const uint8_t* const text,
+                 uint8_t* const cipher,
+                 const size_t ct_stride,
+                 const size_t ct_len,
+                 uint8_t* const __restrict tag,
+                 const size_t n)
+{
+  using namespace tinyjambu;
+
+  if constexpr (v == variant::key_128) {
+    tinyjambu_128::encrypt_soa<fbk>(key,
+                                    nonce,
+                                    data,
+                                    data_stride,
+                                    data_len,
+                                    text,
+                                    cipher,
+                                    ct_stride,
+                                    ct_len,
+                                    tag,
+                                    n);
+  } else if constexpr (v == variant::key_192) {
+    tinyjambu_192::encrypt_soa<fbk>(key,
+                                    nonce,
+                                    data,
+                                    data_stride,
+                                    data_len,
+                                    text,
+                                    cipher,
+                                    ct_stride,
+                                    ct_len,
+                                    tag,
+                                    n);
+  } else {
+    tinyjambu_256::encrypt_soa<fbk>(key,
+                                    nonce,
+                                    data,
+                                    data_stride,
+                                    data_len,
+                                    text,
+                                    cipher,
+                                    ct_stride,
+                                    ct_len,
+                                    tag,
+                                    n);
+  }
+}
+
+// Structure-of-arrays TinyJambu-{128, 192, 256} verified decryption of
+// fixed-size records, picking variant & feedback bit width at compile-time
+template<const tinyjambu::variant v, const fbk_t fbk = DEFAULT_FBK>
+inline void
+aead_decrypt_soa(const uint8_t* const __restrict key,
+                 const uint8_t* const __restrict nonce,
+                 const uint8_t* const __restrict tag,
+                 const uint8_t* const __restrict data,
+                 const size_t data_stride,
+                 const size_t data_len,
+                 const uint8_t* const cipher,
+                 uint8_t* const text,
+                 const size_t ct_stride,
+                 const size_t ct_len,
+                 bool* const __restrict flag,
+                 const size_t n)
+{
+  using namespace tinyjambu;
+
+  if constexpr (v == variant::key_128) {
+    tinyjambu_128::decrypt_soa<fbk>(key,
+                                    nonce,
+                                    tag,
+                                    data,
+                                    data_stride,
+                                    data_len,
+                                    cipher,
+                                    text,
+                                    ct_stride,
+                                    ct_len,
+                                    flag,
+                                    n);
+  } else if constexpr (v == variant::key_192) {
+    tinyjambu_192::decrypt_soa<fbk>(key,
+                                    nonce,
+                                    tag,
+                                    data,
+                                    data_stride,
+                                    data_len,
+                                    cipher,
+                                    text,
+                                    ct_stride,
+                                    ct_len,
+                                    flag,
+                                    n);
+  } else {
+    tinyjambu_256::decrypt_soa<fbk>(key,
+                                    nonce,
+                                    tag,
+                                    data,
+                                    data_stride,
+                                    data_len,
+                                    cipher,
+                                    text,
+                                    ct_stride,
+                                    ct_len,
+                                    flag,
+                                    n);
+  }
+}
+
+// Fixed-length TinyJambu-{128, 192, 256} authenticated encryption, for
+// `ad_len` -bytes associated data & `ct_len` -bytes plain text, picking
+// variant & feedback bit width at compile-time
+template<const tinyjambu::variant v,
+         const size_t ad_len,
+         const size_t ct_len,
+         const fbk_t fbk = DEFAULT_FBK>
+inline void
+aead_encrypt_fixed(const uint8_t* const __restrict key,
+                   const uint8_t* const __restrict nonce,
+                   const uint8_t* const __restrict data,
+                   const uint8_t* const text,
+                   uint8_t* const cipher,
+                   uint8_t* const __restrict tag)
+{
+  using namespace tinyjambu;
+
+  if constexpr (v == variant::key_128) {
+    tinyjambu_128::encrypt<ad_len, ct_len, fbk>(
+      key, nonce, data, text, cipher, tag);
+  } else if constexpr (v == variant::key_192) {
+    tinyjambu_192::encrypt<ad_len, ct_len, fbk>(
+      key, nonce, data, text, cipher, tag);
+  } else {
+    tinyjambu_256::encrypt<ad_len, ct_len, fbk>(
+      key, nonce, data, text, cipher, tag);
+  }
+}
+
+// Fixed-length TinyJambu-{128, 192, 256} verified decryption, for `ad_len`
+// -bytes associated data & `ct_len` -bytes cipher text, picking variant &
+// feedback bit width at compile-time
+template<const tinyjambu::variant v,
+         const size_t ad_len,
+         const size_t ct_len,
+         const fbk_t fbk = DEFAULT_FBK>
+inline bool
+aead_decrypt_fixed(const uint8_t* const __restrict key,
+                   const uint8_t* const __restrict nonce,
+                   const uint8_t* const __restrict tag,
+                   const uint8_t* const __restrict data,
+                   const uint8_t* const cipher,
+                   uint8_t* const text)
+{
+  using namespace tinyjambu;
+
+  if constexpr (v == variant::key_128) {
+    return tinyjambu_128::decrypt<ad_len, ct_len, fbk>(
+      key, nonce, tag, data, cipher, text);
+  } else if constexpr (v == variant::key_192) {
+    return tinyjambu_192::decrypt<ad_len, ct_len, fbk>(
+      key, nonce, tag, data, cipher, text);
+  } else {
+    return tinyjambu_256::decrypt<ad_len, ct_len, fbk>(
+      key, nonce, tag, data, cipher, text);
+  }
+}
+
 }
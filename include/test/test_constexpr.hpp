@@ -0,0 +1,208 @@
+#pragma once
+#include "blob.hpp"
+#include "test_common.hpp"
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace test_tinyjambu {
+
+// Known answers for TinyJambu-{128, 192, 256} AEAD, where secret key, nonce,
+// associated data & plain text bytes are 00, 01, 02, ... ( same as NIST LWC
+// KAT generator ), each holding cipher text, followed by authentication tag
+template<const tinyjambu::variant v, const size_t ct_len, const size_t dt_len>
+constexpr auto
+known_answer()
+{
+  using namespace tinyjambu;
+
+  constexpr size_t vi = static_cast<size_t>(v);
+  constexpr size_t ci = ct_len == 0 ? 0 : ct_len == 5 ? 1 : 2;
+
+  constexpr uint8_t kat[3][3][24]{
+    {
+      { 0xed, 0x7b, 0x37, 0xcc, 0x6e, 0x9b, 0xdc, 0x7b },
+      { 0x14, 0x38, 0x74, 0x8a, 0x20, 0xb9, 0x2b, 0x72, 0xb7, 0x7f, 0xc1, 0x69,
+        0xbc },
+      { 0x30, 0xdb, 0x0e, 0x18, 0xa6, 0x64, 0x6b, 0xe4, 0xc5, 0x6a, 0x76, 0x58,
+        0xe7, 0x6b, 0xa3, 0x0b, 0x1f, 0x9c, 0x14, 0xf8, 0x77, 0x52, 0x56,
+        0xb1 },
+    },
+    {
+      { 0x44, 0xca, 0x46, 0x64, 0x22, 0x30, 0xf1, 0xc5 },
+      { 0x07, 0xe3, 0x48, 0xfa, 0xb6, 0xa2, 0x77, 0x59, 0x33, 0x13, 0x0c, 0xf4,
+        0xa1 },
+      { 0x21, 0x0a, 0x00, 0xe8, 0xb6, 0x45, 0xf7, 0x81, 0x94, 0x6a, 0x7f, 0x6c,
+        0xff, 0xb2, 0xaa, 0x89, 0xa5, 0xae, 0xe5, 0xb4, 0xcf, 0x13, 0x1a,
+        0x31 },
+    },
+    {
+      { 0x19, 0x16, 0x4f, 0x59, 0x6e, 0x4f, 0xe8, 0xdd },
+      { 0x67, 0x38, 0x79, 0x40, 0xb9, 0xfd, 0x05, 0x33, 0x01, 0xdf, 0x88, 0x02,
+        0x6d },
+      { 0xa0, 0x31, 0x67, 0x45, 0x79, 0xaa, 0x6d, 0x4e, 0xa5, 0x52, 0x38, 0x4c,
+        0x5a, 0xb7, 0x03, 0x69, 0xbc, 0x85, 0xb0, 0x3d, 0x10, 0x4b, 0x4c,
+        0xcf },
+    },
+  };
+
+  static_assert((ct_len == 0 && dt_len == 0) || (ct_len == 5 && dt_len == 3) ||
+                  (ct_len == 16 && dt_len == 16),
+                "No known answer for given lengths");
+
+  std::array<uint8_t, ct_len + 8> res{};
+  for (size_t i = 0; i < res.size(); i++) {
+    res[i] = kat[vi][ci][i];
+  }
+  return res;
+}
+
+// Returns N -bytes array, holding 00, 01, 02, ...
+template<const size_t N>
+constexpr std::array<uint8_t, N>
+counting()
+{
+  std::array<uint8_t, N> res{};
+  for (size_t i = 0; i < N; i++) {
+    res[i] = static_cast<uint8_t>(i);
+  }
+  return res;
+}
+
+// Seals `ct_len` -bytes plain text & `dt_len` -bytes associated data ( see
+// `known_answer` ), at compile-time, using `tinyjambu_{128, 192, 256}::seal`
+// ( see `aead_seal` )
+template<const tinyjambu::variant v, const size_t ct_len, const size_t dt_len>
+constexpr auto
+seal_const()
+{
+  using namespace tinyjambu;
+
+  constexpr auto key = counting<blob::KEY_LEN<v>>();
+  constexpr auto nonce = counting<12>();
+  constexpr auto data = counting<dt_len>();
+  constexpr auto text = counting<ct_len>();
+
+  std::array<uint8_t, ct_len + 8> sealed{};
+
+  aead_seal<v>(key.data(),
+               nonce.data(),
+               data.data(),
+               dt_len,
+               text.data(),
+               ct_len,
+               sealed.data());
+
+  return sealed;
+}
+
+// Compile-time checks, that both one-shot API & `blob::seal`, evaluated by
+// compiler, produce known answers, while one-shot `open` & `blob::open` restore
+// plain text, also during constant evaluation
+template<const tinyjambu::variant v, const size_t ct_len, const size_t dt_len>
+constexpr bool
+check_const()
+{
+  using namespace tinyjambu;
+
+  constexpr auto key = counting<blob::KEY_LEN<v>>();
+  constexpr auto nonce = counting<12>();
+  constexpr auto data = counting<dt_len>();
+  constexpr auto text = counting<ct_len>();
+
+  constexpr auto sealed = blob::seal<v>(key, nonce, text, data);
+
+  static_assert(seal_const<v, ct_len, dt_len>() ==
+                known_answer<v, ct_len, dt_len>());
+  static_assert(sealed == known_answer<v, ct_len, dt_len>());
+  static_assert([&] {
+    std::array<uint8_t, ct_len + 1> text_{};
+    const bool flag = aead_open<v>(key.data(),
+                                   nonce.data(),
+                                   data.data(),
+                                   dt_len,
+                                   sealed.data(),
+                                   sealed.size(),
+                                   text_.data());
+    return flag && std::equal(text.begin(), text.end(), text_.begin());
+  }());
+  static_assert([&] {
+    std::array<uint8_t, ct_len> text_{};
+    const bool flag =
+      blob::open<v>(key.data(), nonce.data(), sealed, text_, data);
+    return flag && text_ == text;
+  }());
+
+  return true;
+}
+
+static_assert(check_const<tinyjambu::variant::key_128, 0, 0>());
+static_assert(check_const<tinyjambu::variant::key_128, 5, 3>());
+static_assert(check_const<tinyjambu::variant::key_128, 16, 16>());
+static_assert(check_const<tinyjambu::variant::key_192, 0, 0>());
+static_assert(check_const<tinyjambu::variant::key_192, 5, 3>());
+static_assert(check_const<tinyjambu::variant::key_192, 16, 16>());
+static_assert(check_const<tinyjambu::variant::key_256, 0, 0>());
+static_assert(check_const<tinyjambu::variant::key_256, 5, 3>());
+static_assert(check_const<tinyjambu::variant::key_256, 16, 16>());
+
+// Test that a blob, sealed at compile-time, is same as what one-shot `seal`
+// computes at runtime, on same input, for `ct_len` -bytes plain text &
+// `dt_len` -bytes associated data, & that opening it at runtime restores
+// plain text, while mutated tag check passes
+template<const tinyjambu::variant v, const size_t ct_len, const size_t dt_len>
+void
+compile_time()
+{
+  using namespace tinyjambu;
+
+  constexpr auto key = counting<blob::KEY_LEN<v>>();
+  constexpr auto nonce = counting<12>();
+  constexpr auto data = counting<dt_len>();
+  constexpr auto text = counting<ct_len>();
+
+  constexpr auto sealed = blob::seal<v>(key, nonce, text, data);
+
+  std::array<uint8_t, ct_len + 8> sealed_{};
+  std::array<uint8_t, ct_len> enc{}, text_{};
+  std::array<uint8_t, 8> tag{};
+
+  aead_encrypt<v>(key.data(),
+                  nonce.data(),
+                  data.data(),
+                  dt_len,
+                  text.data(),
+                  enc.data(),
+                  ct_len,
+                  tag.data());
+
+  std::copy(enc.begin(), enc.end(), sealed_.begin());
+  std::copy(tag.begin(), tag.end(), sealed_.begin() + ct_len);
+
+  assert(sealed == sealed_);
+
+  bool flag = blob::open<v>(key.data(), nonce.data(), sealed_, text_, data);
+  assert(flag);
+  assert(text_ == text);
+
+  sealed_[ct_len] ^= static_cast<uint8_t>(1);
+
+  flag = blob::open<v>(key.data(), nonce.data(), sealed_, text_, data);
+  assert(!flag);
+  if constexpr (ct_len > 0) {
+    assert(is_zeros(text_.data(), ct_len));
+  }
+}
+
+// Runs `compile_time` test, for all plain text lengths in [0, 9) & associated
+// data lengths in [0, 5)
+template<const tinyjambu::variant v>
+void
+compile_time_all()
+{
+  unroll<9>([](const auto i) {
+    unroll<5>([&](const auto j) { compile_time<v, i, j>(); });
+  });
+}
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "test_common.hpp"
+#include <cassert>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Test that TinyJambu-{128, 192, 256} produces same cipher text & tag, no
+// matter which feedback bit width ( i.e. 32/ 64/ 128 -bit, fully unrolled or
+// 64 -bit on 64 -bit limbs ) underlying permutation is instantiated with, all
+// living in same binary, while ensuring that message encrypted using one width
+// can be decrypted using another one
+template<const tinyjambu::variant v>
+void
+feedback_widths(const size_t dt_len, const size_t ct_len)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  std::vector<uint8_t> key(klen), nonce(12), data(dt_len), text(ct_len);
+  std::vector<uint8_t> enc32(ct_len), enc64(ct_len), enc128(ct_len);
+  std::vector<uint8_t> enc_all(ct_len), tag_all(8);
+  std::vector<uint8_t> enc_u64(ct_len), tag_u64(8);
+  std::vector<uint8_t> tag32(8), tag64(8), tag128(8);
+  std::vector<uint8_t> dec(ct_len);
+
+  random_data(key.data(), klen);
+  random_data(nonce.data(), 12);
+  random_data(data.data(), dt_len);
+  random_data(text.data(), ct_len);
+
+  const uint8_t* const k = key.data();
+  const uint8_t* const n = nonce.data();
+  const uint8_t* const d = data.data();
+  const uint8_t* const t = text.data();
+
+  using enum fbk_t;
+
+  aead_encrypt<v, fbk_32>(
+    k, n, d, dt_len, t, enc32.data(), ct_len, tag32.data());
+  aead_encrypt<v, fbk_64>(
+    k, n, d, dt_len, t, enc64.data(), ct_len, tag64.data());
+  aead_encrypt<v, fbk_128>(
+    k, n, d, dt_len, t, enc128.data(), ct_len, tag128.data());
+  aead_encrypt<v, fbk_all>(
+    k, n, d, dt_len, t, enc_all.data(), ct_len, tag_all.data());
+  aead_encrypt<v, fbk_u64>(
+    k, n, d, dt_len, t, enc_u64.data(), ct_len, tag_u64.data());
+
+  assert(enc32 == enc64 && enc64 == enc128 && enc128 == enc_all);
+  assert(tag32 == tag64 && tag64 == tag128 && tag128 == tag_all);
+  assert(enc_all == enc_u64 && tag_all == tag_u64);
+
+  bool f = aead_decrypt<v, fbk_128>(
+    k, n, tag32.data(), d, dt_len, enc32.data(), dec.data(), ct_len);
+
+  assert(f);
+  assert(dec == text);
+
+  f = aead_decrypt<v, fbk_32>(
+    k, n, tag128.data(), d, dt_len, enc128.data(), dec.data(), ct_len);
+
+  assert(f);
+  assert(dec == text);
+
+  f = aead_decrypt<v, fbk_all>(
+    k, n, tag64.data(), d, dt_len, enc64.data(), dec.data(), ct_len);
+
+  assert(f);
+  assert(dec == text);
+
+  f = aead_decrypt<v, fbk_u64>(
+    k, n, tag32.data(), d, dt_len, enc32.data(), dec.data(), ct_len);
+
+  assert(f);
+  assert(dec == text);
+
+  f = aead_decrypt<v, fbk_32>(
+    k, n, tag_u64.data(), d, dt_len, enc_u64.data(), dec.data(), ct_len);
+
+  assert(f);
+  assert(dec == text);
+}
+
+}
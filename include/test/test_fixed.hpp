@@ -0,0 +1,71 @@
+#pragma once
+#include "test_common.hpp"
+#include <cassert>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Test fixed-length TinyJambu-{128, 192, 256} AEAD, for `ad_len` -bytes
+// associated data & `ct_len` -bytes plain text, by checking that it produces
+// same cipher text & authentication tag as runtime length one-shot `encrypt`,
+// that decryption restores plain text & that mutated tag check passes
+template<const tinyjambu::variant v, const size_t ad_len, const size_t ct_len>
+void
+fixed()
+{
+  using namespace tinyjambu;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  // extra byte, so that zero length buffers still have valid address
+  std::vector<uint8_t> key(klen), nonce(12), data(ad_len + 1);
+  std::vector<uint8_t> text(ct_len + 1), enc(ct_len + 1), dec(ct_len + 1);
+  std::vector<uint8_t> enc_(ct_len + 1), tag(8), tag_(8);
+
+  random_data(key.data(), klen);
+  random_data(nonce.data(), 12);
+  random_data(data.data(), ad_len);
+  random_data(text.data(), ct_len);
+
+  const uint8_t* const k = key.data();
+  const uint8_t* const n = nonce.data();
+
+  aead_encrypt_fixed<v, ad_len, ct_len>(
+    k, n, data.data(), text.data(), enc.data(), tag.data());
+  bool flag = aead_decrypt_fixed<v, ad_len, ct_len>(
+    k, n, tag.data(), data.data(), enc.data(), dec.data());
+
+  aead_encrypt<v>(
+    k, n, data.data(), ad_len, text.data(), enc_.data(), ct_len, tag_.data());
+
+  assert(flag);
+  assert(enc == enc_);
+  assert(tag == tag_);
+  assert(dec == text);
+
+  tag[0] ^= static_cast<uint8_t>(1);
+  flag = aead_decrypt_fixed<v, ad_len, ct_len>(
+    k, n, tag.data(), data.data(), enc.data(), dec.data());
+
+  assert(!flag);
+  if constexpr (ct_len > 0) {
+    assert(is_zeros(dec.data(), ct_len));
+  }
+}
+
+// Test fixed-length TinyJambu-{128, 192, 256} AEAD, for all associated data
+// lengths in [0, 5) & plain text lengths in [0, 9), covering every partial
+// word length, alongside few common record shapes
+template<const tinyjambu::variant v>
+void
+fixed_all()
+{
+  unroll<5>([](const auto i) {
+    unroll<9>([&](const auto j) { fixed<v, i, j>(); });
+  });
+
+  fixed<v, 16, 48>();
+  fixed<v, 13, 61>();
+}
+
+}
@@ -0,0 +1,116 @@
+#pragma once
+#include "test_common.hpp"
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// In-place TinyJambu-{128, 192, 256} authenticated encryption, picking variant
+// at compile-time
+template<const tinyjambu::variant v>
+inline void
+aead_encrypt_inplace(const uint8_t* const __restrict key,
+                     const uint8_t* const __restrict nonce,
+                     const uint8_t* const __restrict data,
+                     const size_t data_len,
+                     uint8_t* const __restrict buf,
+                     const size_t ct_len,
+                     uint8_t* const __restrict tag)
+{
+  using namespace tinyjambu;
+
+  if constexpr (v == variant::key_128) {
+    tinyjambu_128::encrypt_inplace(
+      key, nonce, data, data_len, buf, ct_len, tag);
+  } else if constexpr (v == variant::key_192) {
+    tinyjambu_192::encrypt_inplace(
+      key, nonce, data, data_len, buf, ct_len, tag);
+  } else {
+    tinyjambu_256::encrypt_inplace(
+      key, nonce, data, data_len, buf, ct_len, tag);
+  }
+}
+
+// In-place TinyJambu-{128, 192, 256} verified decryption, picking variant at
+// compile-time
+template<const tinyjambu::variant v>
+inline bool
+aead_decrypt_inplace(const uint8_t* const __restrict key,
+                     const uint8_t* const __restrict nonce,
+                     const uint8_t* const __restrict tag,
+                     const uint8_t* const __restrict data,
+                     const size_t data_len,
+                     uint8_t* const __restrict buf,
+                     const size_t ct_len)
+{
+  using namespace tinyjambu;
+
+  bool flg = false;
+
+  if constexpr (v == variant::key_128) {
+    flg = tinyjambu_128::decrypt_inplace(
+      key, nonce, tag, data, data_len, buf, ct_len);
+  } else if constexpr (v == variant::key_192) {
+    flg = tinyjambu_192::decrypt_inplace(
+      key, nonce, tag, data, data_len, buf, ct_len);
+  } else {
+    flg = tinyjambu_256::decrypt_inplace(
+      key, nonce, tag, data, data_len, buf, ct_len);
+  }
+
+  return flg;
+}
+
+// Test in-place TinyJambu-{128, 192, 256} AEAD, by ensuring that cipher text &
+// authentication tag, computed by overwriting plain text, match with what
+// out-of-place `encrypt` computes, then decrypting in-place, which must restore
+// plain text, while decrypting with a mutated tag ( single bit flip ) must fail
+// verification & zero the buffer
+template<const tinyjambu::variant v>
+void
+inplace(const size_t dt_len, const size_t ct_len)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  std::vector<uint8_t> key(klen), nonce(12), data(dt_len), text(ct_len);
+  std::vector<uint8_t> enc(ct_len), buf(ct_len);
+  std::vector<uint8_t> tag(8), tag_(8);
+
+  random_data(key.data(), klen);
+  random_data(nonce.data(), 12);
+  random_data(data.data(), dt_len);
+  random_data(text.data(), ct_len);
+
+  const uint8_t* const k = key.data();
+  const uint8_t* const n = nonce.data();
+  const uint8_t* const d = data.data();
+
+  aead_encrypt<v>(k, n, d, dt_len, text.data(), enc.data(), ct_len, tag.data());
+
+  std::copy(text.begin(), text.end(), buf.begin());
+  aead_encrypt_inplace<v>(k, n, d, dt_len, buf.data(), ct_len, tag_.data());
+
+  assert(buf == enc);
+  assert(tag == tag_);
+
+  bool f =
+    aead_decrypt_inplace<v>(k, n, tag.data(), d, dt_len, buf.data(), ct_len);
+
+  assert(f);
+  assert(buf == text);
+
+  aead_encrypt_inplace<v>(k, n, d, dt_len, buf.data(), ct_len, tag_.data());
+  tag_[0] ^= static_cast<uint8_t>(1);
+
+  f = aead_decrypt_inplace<v>(k, n, tag_.data(), d, dt_len, buf.data(), ct_len);
+
+  assert(!f);
+  if (ct_len > 0) {
+    assert(is_zeros(buf.data(), ct_len));
+  }
+}
+
+}
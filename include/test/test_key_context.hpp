@@ -0,0 +1,162 @@
+#pragma once
+#include "test_common.hpp"
+#include <cassert>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Test TinyJambu-{128, 192, 256} secret key context by encrypting `msg_cnt`
+// -many messages under same key context, ensuring that each cipher text &
+// authentication tag matches with what one-shot `encrypt` computes, then
+// decrypting them using key context, while mutating ( single bit flip ) every
+// other message's tag, which must fail verification
+template<const tinyjambu::variant v>
+void
+key_context(const size_t msg_cnt, const size_t dt_len, const size_t ct_len)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  std::vector<uint8_t> key(klen), nonce(12), data(dt_len), text(ct_len);
+  std::vector<uint8_t> enc(ct_len), enc_(ct_len), dec(ct_len);
+  std::vector<uint8_t> tag(8), tag_(8);
+
+  random_data(key.data(), klen);
+
+  const tinyjambu::key_context<v> ctx{ key.data() };
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    random_data(nonce.data(), 12);
+    random_data(data.data(), dt_len);
+    random_data(text.data(), ct_len);
+
+    ctx.encrypt(nonce.data(),
+                data.data(),
+                dt_len,
+                text.data(),
+                enc.data(),
+                ct_len,
+                tag.data());
+    aead_encrypt<v>(key.data(),
+                    nonce.data(),
+                    data.data(),
+                    dt_len,
+                    text.data(),
+                    enc_.data(),
+                    ct_len,
+                    tag_.data());
+
+    assert(enc == enc_);
+    assert(tag == tag_);
+
+    if (i & 1ul) {
+      tag[0] ^= static_cast<uint8_t>(1);
+    }
+
+    const bool f = ctx.decrypt(nonce.data(),
+                               tag.data(),
+                               data.data(),
+                               dt_len,
+                               enc.data(),
+                               dec.data(),
+                               ct_len);
+
+    if (i & 1ul) {
+      assert(!f);
+      if (ct_len > 0) {
+        assert(is_zeros(dec.data(), ct_len));
+      }
+    } else {
+      assert(f);
+      assert(dec == text);
+    }
+  }
+}
+
+// Test TinyJambu-{128, 192, 256} nonce prefix context by encrypting `msg_cnt`
+// -many messages, under same secret key & 8 -bytes nonce prefix, with last 4
+// -bytes of nonce being a big endian message counter, ensuring that each cipher
+// text & authentication tag matches with what one-shot `encrypt` computes using
+// full 96 -bit nonce, then decrypting & verifying them using nonce prefix
+// context
+template<const tinyjambu::variant v>
+void
+nonce_prefix_context(const size_t msg_cnt,
+                     const size_t dt_len,
+                     const size_t ct_len)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  std::vector<uint8_t> key(klen), nonce(12), data(dt_len), text(ct_len);
+  std::vector<uint8_t> enc(ct_len), enc_(ct_len), dec(ct_len);
+  std::vector<uint8_t> tag(8), tag_(8);
+
+  random_data(key.data(), klen);
+  random_data(nonce.data(), 8);
+
+  const tinyjambu::nonce_prefix_context<v> ctx{ key.data(), nonce.data() };
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    const uint32_t ctr = static_cast<uint32_t>(i);
+
+    nonce[8] = static_cast<uint8_t>(ctr >> 24);
+    nonce[9] = static_cast<uint8_t>(ctr >> 16);
+    nonce[10] = static_cast<uint8_t>(ctr >> 8);
+    nonce[11] = static_cast<uint8_t>(ctr >> 0);
+
+    random_data(data.data(), dt_len);
+    random_data(text.data(), ct_len);
+
+    ctx.encrypt(nonce.data() + 8,
+                data.data(),
+                dt_len,
+                text.data(),
+                enc.data(),
+                ct_len,
+                tag.data());
+    aead_encrypt<v>(key.data(),
+                    nonce.data(),
+                    data.data(),
+                    dt_len,
+                    text.data(),
+                    enc_.data(),
+                    ct_len,
+                    tag_.data());
+
+    assert(enc == enc_);
+    assert(tag == tag_);
+
+    const bool f = ctx.decrypt(nonce.data() + 8,
+                               tag.data(),
+                               data.data(),
+                               dt_len,
+                               enc.data(),
+                               dec.data(),
+                               ct_len);
+
+    assert(f);
+    assert(dec == text);
+    assert(ctx.verify(
+      nonce.data() + 8, tag.data(), data.data(), dt_len, enc.data(), ct_len));
+
+    // message must not verify under different nonce suffix
+    nonce[11] ^= static_cast<uint8_t>(1);
+
+    const bool g = ctx.decrypt(nonce.data() + 8,
+                               tag.data(),
+                               data.data(),
+                               dt_len,
+                               enc.data(),
+                               dec.data(),
+                               ct_len);
+
+    assert(!g);
+    assert(!ctx.verify(
+      nonce.data() + 8, tag.data(), data.data(), dt_len, enc.data(), ct_len));
+  }
+}
+
+}
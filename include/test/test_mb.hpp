@@ -0,0 +1,152 @@
+#pragma once
+#include "mb_manager.hpp"
+#include "test_common.hpp"
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Test multi-buffer TinyJambu-{128, 192, 256} AEAD job manager, by submitting
+// `job_cnt` -many encryption jobs, each with its own secret key & nonce, of
+// different associated data & plain text lengths ( upto `max_dt` & `max_ct`
+// -bytes, respectively ), which must produce same cipher text & authentication
+// tag as one-shot `encrypt`, where no job is completed before all lanes are
+// busy & every job is returned exactly once. Then decrypting them, where every
+// third job's tag is mutated ( single bit flip ), must restore plain text of
+// all other jobs, while those with mutated tag must fail verification & have
+// their plain text zeroed.
+template<const tinyjambu::variant v>
+void
+multi_buffer(const size_t job_cnt, const size_t max_dt, const size_t max_ct)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+  constexpr size_t lanes = sizeof(lanes_t) / sizeof(uint32_t);
+
+  std::vector<std::vector<uint8_t>> key(job_cnt), nonce(job_cnt);
+  std::vector<std::vector<uint8_t>> data(job_cnt), text(job_cnt);
+  std::vector<std::vector<uint8_t>> enc(job_cnt), dec(job_cnt);
+  std::vector<std::vector<uint8_t>> tag(job_cnt);
+
+  std::vector<mb::job_t> jobs(job_cnt);
+
+  for (size_t i = 0; i < job_cnt; i++) {
+    // mix of short & long messages, so that lanes finish at different times
+    const size_t dt_len = (i * 7) % (max_dt + 1);
+    const size_t ct_len = (i % 5 == 0) ? max_ct : (i * 13) % (max_ct / 8 + 1);
+
+    key[i].resize(klen);
+    nonce[i].resize(12);
+    data[i].resize(dt_len);
+    text[i].resize(ct_len);
+    enc[i].resize(ct_len);
+    dec[i].resize(ct_len);
+    tag[i].resize(8);
+
+    random_data(key[i].data(), klen);
+    random_data(nonce[i].data(), 12);
+    random_data(data[i].data(), dt_len);
+    random_data(text[i].data(), ct_len);
+
+    jobs[i] = mb::job_t{ direction_t::encrypt,
+                         key[i].data(),
+                         nonce[i].data(),
+                         data[i],
+                         text[i],
+                         enc[i],
+                         tag[i].data(),
+                         mb::status_t::pending };
+  }
+
+  // Submits all jobs & then flushes manager, returning # -of times each job
+  // was returned
+  auto run = [&](mb::manager<v>& m) {
+    std::vector<size_t> seen(job_cnt, 0);
+
+    auto record = [&](mb::job_t* const j) {
+      assert(j >= jobs.data() && j < jobs.data() + job_cnt);
+      assert(j->status != mb::status_t::pending);
+      seen[static_cast<size_t>(j - jobs.data())]++;
+    };
+
+    for (size_t i = 0; i < job_cnt; i++) {
+      mb::job_t* const j = m.submit(&jobs[i]);
+      if (i + 1 < lanes) {
+        assert(j == nullptr);
+      }
+      if (j != nullptr) {
+        record(j);
+      }
+    }
+
+    while (mb::job_t* const j = m.flush()) {
+      record(j);
+    }
+
+    assert(m.in_flight() == 0);
+    assert(m.flush() == nullptr);
+    return seen;
+  };
+
+  {
+    mb::manager<v> m;
+    const std::vector<size_t> seen = run(m);
+
+    assert(std::all_of(seen.begin(), seen.end(), [](size_t c) {
+      return c == 1;
+    }));
+  }
+
+  std::vector<uint8_t> enc_, tag_(8);
+
+  for (size_t i = 0; i < job_cnt; i++) {
+    enc_.resize(text[i].size());
+    aead_encrypt<v>(key[i].data(),
+                    nonce[i].data(),
+                    data[i].data(),
+                    data[i].size(),
+                    text[i].data(),
+                    enc_.data(),
+                    text[i].size(),
+                    tag_.data());
+
+    assert(jobs[i].status == mb::status_t::completed);
+    assert(enc_ == enc[i]);
+    assert(tag_ == tag[i]);
+  }
+
+  for (size_t i = 0; i < job_cnt; i++) {
+    if (i % 3 == 0) {
+      tag[i][7] ^= static_cast<uint8_t>(1);
+    }
+
+    jobs[i].dir = direction_t::decrypt;
+    jobs[i].in = enc[i];
+    jobs[i].out = dec[i];
+  }
+
+  {
+    mb::manager<v> m;
+    const std::vector<size_t> seen = run(m);
+
+    assert(std::all_of(seen.begin(), seen.end(), [](size_t c) {
+      return c == 1;
+    }));
+  }
+
+  for (size_t i = 0; i < job_cnt; i++) {
+    if (i % 3 == 0) {
+      assert(jobs[i].status == mb::status_t::auth_failed);
+      if (!dec[i].empty()) {
+        assert(is_zeros(dec[i].data(), dec[i].size()));
+      }
+    } else {
+      assert(jobs[i].status == mb::status_t::completed);
+      assert(dec[i] == text[i]);
+    }
+  }
+}
+
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include "parallel.hpp"
+#include "test_common.hpp"
+#include <cassert>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Test multi-threaded TinyJambu-{128, 192, 256} AEAD by encrypting `msg_cnt`
+// -many messages of skewed lengths ( few large ones, among many small ones ),
+// using a pool of `n` workers, then comparing output with what one-shot
+// `encrypt` computes for each message, before decrypting them in parallel,
+// where every third message's tag is mutated ( single bit flip ), which must
+// fail verification & zero plain text
+template<const tinyjambu::variant v>
+void
+parallel(tinyjambu::parallel::pool& pool, const size_t msg_cnt)
+{
+  using namespace tinyjambu;
+  using parallel::job_t;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  std::vector<std::vector<uint8_t>> key(msg_cnt), nonce(msg_cnt);
+  std::vector<std::vector<uint8_t>> data(msg_cnt), text(msg_cnt);
+  std::vector<std::vector<uint8_t>> enc(msg_cnt), dec(msg_cnt);
+  std::vector<std::vector<uint8_t>> tag(msg_cnt), tag_(msg_cnt);
+  std::vector<job_t> ejobs(msg_cnt), djobs(msg_cnt);
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    const size_t dt_len = (i * 7ul) % 33;
+    const size_t ct_len = i % 17 == 0 ? 40000 + i : (i * 13ul) % 301;
+
+    key[i].resize(klen);
+    nonce[i].resize(12);
+    data[i].resize(dt_len);
+    text[i].resize(ct_len);
+    enc[i].resize(ct_len);
+    dec[i].resize(ct_len);
+    tag[i].resize(8);
+    tag_[i].resize(8);
+
+    random_data(key[i].data(), klen);
+    random_data(nonce[i].data(), 12);
+    random_data(data[i].data(), dt_len);
+    random_data(text[i].data(), ct_len);
+
+    ejobs[i] = job_t{ key[i].data(), nonce[i].data(), data[i],
+                      text[i],       enc[i],          tag[i].data() };
+    djobs[i] = job_t{ key[i].data(), nonce[i].data(), data[i],
+                      enc[i],        dec[i],          tag[i].data() };
+  }
+
+  pool.encrypt<v>(ejobs);
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    std::vector<uint8_t> enc_(text[i].size());
+
+    aead_encrypt<v>(key[i].data(),
+                    nonce[i].data(),
+                    data[i].data(),
+                    data[i].size(),
+                    text[i].data(),
+                    enc_.data(),
+                    text[i].size(),
+                    tag_[i].data());
+
+    assert(enc_ == enc[i]);
+    assert(tag_[i] == tag[i]);
+
+    if (i % 3ul == 0ul) {
+      tag[i][0] ^= static_cast<uint8_t>(1);
+    }
+  }
+
+  const std::vector<bool> flags = pool.decrypt<v>(djobs);
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    if (i % 3ul == 0ul) {
+      assert(!flags[i]);
+      if (dec[i].size() > 0) {
+        assert(is_zeros(dec[i].data(), dec[i].size()));
+      }
+    } else {
+      assert(flags[i]);
+      assert(dec[i] == text[i]);
+    }
+  }
+}
+
+}
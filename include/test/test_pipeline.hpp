@@ -0,0 +1,251 @@
+#pragma once
+#include "pipeline.hpp"
+#include "test_common.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Test lock-free TinyJambu-{128, 192, 256} AEAD pipeline stage, with `n`
+// workers & a ring of 8 job descriptors ( so that it wraps around many times
+// ), by producing `msg_cnt` -many encryption jobs, of varying lengths, from a
+// separate thread, while consuming them on calling thread, which must receive
+// them in production order, with same cipher text & authentication tag as
+// one-shot `encrypt`. Then same is done for decryption, where every third
+// job's tag is mutated ( single bit flip ), which must fail verification &
+// zero plain text, while all other jobs must restore plain text.
+template<const tinyjambu::variant v>
+void
+pipeline(const size_t n, const size_t msg_cnt)
+{
+  using namespace tinyjambu;
+  using job_t = tinyjambu::pipeline::job_t<v>;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  std::vector<uint8_t> key(klen);
+  random_data(key.data(), klen);
+
+  const tinyjambu::key_context<v> ctx{ key.data() };
+
+  std::vector<std::vector<uint8_t>> nonce(msg_cnt), data(msg_cnt);
+  std::vector<std::vector<uint8_t>> text(msg_cnt), enc(msg_cnt);
+  std::vector<std::vector<uint8_t>> dec(msg_cnt), tag(msg_cnt);
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    const size_t dt_len = (i * 7ul) % 33;
+    const size_t ct_len = i % 11 == 0 ? 4096 + i : (i * 13ul) % 129;
+
+    nonce[i].resize(12);
+    data[i].resize(dt_len);
+    text[i].resize(ct_len);
+    enc[i].resize(ct_len);
+    dec[i].resize(ct_len);
+    tag[i].resize(8);
+
+    random_data(nonce[i].data(), 12);
+    random_data(data[i].data(), dt_len);
+    random_data(text[i].data(), ct_len);
+  }
+
+  // Produces i-th job, from separate thread, while consuming jobs on calling
+  // thread, invoking `check` on each of them, in order
+  auto run = [&](auto make, auto check) {
+    tinyjambu::pipeline::stage<v, DEFAULT_FBK, 8> stage{ n };
+
+    std::thread producer{ [&] {
+      for (size_t i = 0; i < msg_cnt; i++) {
+        const job_t j = make(i);
+        while (!stage.try_push(j)) {
+          std::this_thread::yield();
+        }
+      }
+    } };
+
+    job_t j{};
+    for (size_t i = 0; i < msg_cnt; i++) {
+      while (!stage.try_pop(j)) {
+        std::this_thread::yield();
+      }
+
+      assert(reinterpret_cast<size_t>(j.user) == i);
+      check(i, j);
+    }
+
+    producer.join();
+    assert(!stage.try_pop(j));
+  };
+
+  std::vector<uint8_t> enc_, tag_(8);
+
+  run(
+    [&](const size_t i) {
+      job_t j{};
+      j.dir = direction_t::encrypt;
+      j.ctx = &ctx;
+      std::memcpy(j.nonce, nonce[i].data(), 12);
+      j.data = data[i];
+      j.in = text[i];
+      j.out = enc[i];
+      j.user = reinterpret_cast<void*>(i);
+      return j;
+    },
+    [&](const size_t i, const job_t& j) {
+      assert(j.ok);
+      std::memcpy(tag[i].data(), j.tag, 8);
+
+      enc_.resize(text[i].size());
+      aead_encrypt<v>(key.data(),
+                      nonce[i].data(),
+                      data[i].data(),
+                      data[i].size(),
+                      text[i].data(),
+                      enc_.data(),
+                      text[i].size(),
+                      tag_.data());
+
+      assert(enc_ == enc[i]);
+      assert(tag_ == tag[i]);
+    });
+
+  run(
+    [&](const size_t i) {
+      job_t j{};
+      j.dir = direction_t::decrypt;
+      j.ctx = &ctx;
+      std::memcpy(j.nonce, nonce[i].data(), 12);
+      std::memcpy(j.tag, tag[i].data(), 8);
+      j.tag[7] ^= static_cast<uint8_t>(i % 3 == 0);
+      j.data = data[i];
+      j.in = enc[i];
+      j.out = dec[i];
+      j.user = reinterpret_cast<void*>(i);
+      return j;
+    },
+    [&](const size_t i, const job_t& j) {
+      if (i % 3 == 0) {
+        assert(!j.ok);
+        if (!dec[i].empty()) {
+          assert(is_zeros(dec[i].data(), dec[i].size()));
+        }
+      } else {
+        assert(j.ok);
+        assert(dec[i] == text[i]);
+      }
+    });
+}
+
+// Test lock-free TinyJambu-{128, 192, 256} AEAD pipeline stage, with `n`
+// workers, 3 producer & 2 consumer threads, sharing a ring of 8 job
+// descriptors, by producing `msg_cnt` -many encryption jobs, which must each be
+// dequeued exactly once, with same cipher text & authentication tag as one-shot
+// `encrypt`
+template<const tinyjambu::variant v>
+void
+pipeline_mpmc(const size_t n, const size_t msg_cnt)
+{
+  using namespace tinyjambu;
+  using job_t = tinyjambu::pipeline::job_t<v>;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+  constexpr size_t producers = 3;
+  constexpr size_t consumers = 2;
+
+  std::vector<uint8_t> key(klen);
+  random_data(key.data(), klen);
+
+  const tinyjambu::key_context<v> ctx{ key.data() };
+
+  std::vector<std::vector<uint8_t>> nonce(msg_cnt), data(msg_cnt);
+  std::vector<std::vector<uint8_t>> text(msg_cnt), enc(msg_cnt);
+  std::vector<std::vector<uint8_t>> tag(msg_cnt);
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    const size_t dt_len = (i * 5ul) % 17;
+    const size_t ct_len = (i * 13ul) % 129;
+
+    nonce[i].resize(12);
+    data[i].resize(dt_len);
+    text[i].resize(ct_len);
+    enc[i].resize(ct_len);
+    tag[i].resize(8);
+
+    random_data(nonce[i].data(), 12);
+    random_data(data[i].data(), dt_len);
+    random_data(text[i].data(), ct_len);
+  }
+
+  std::vector<std::atomic<size_t>> seen(msg_cnt);
+  std::atomic<size_t> popped{ 0 };
+
+  {
+    tinyjambu::pipeline::stage<v, DEFAULT_FBK, 8> stage{ n };
+    std::vector<std::thread> threads;
+
+    for (size_t p = 0; p < producers; p++) {
+      threads.emplace_back([&, p] {
+        for (size_t i = p; i < msg_cnt; i += producers) {
+          job_t j{};
+          j.dir = direction_t::encrypt;
+          j.ctx = &ctx;
+          std::memcpy(j.nonce, nonce[i].data(), 12);
+          j.data = data[i];
+          j.in = text[i];
+          j.out = enc[i];
+          j.user = reinterpret_cast<void*>(i);
+
+          while (!stage.try_push(j)) {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+
+    for (size_t c = 0; c < consumers; c++) {
+      threads.emplace_back([&] {
+        job_t j{};
+        while (popped.load() < msg_cnt) {
+          if (!stage.try_pop(j)) {
+            std::this_thread::yield();
+            continue;
+          }
+
+          const size_t i = reinterpret_cast<size_t>(j.user);
+
+          assert(j.ok);
+          std::memcpy(tag[i].data(), j.tag, 8);
+          seen[i].fetch_add(1);
+          popped.fetch_add(1);
+        }
+      });
+    }
+
+    for (std::thread& t : threads) {
+      t.join();
+    }
+  }
+
+  std::vector<uint8_t> enc_, tag_(8);
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    assert(seen[i].load() == 1);
+
+    enc_.resize(text[i].size());
+    aead_encrypt<v>(key.data(),
+                    nonce[i].data(),
+                    data[i].data(),
+                    data[i].size(),
+                    text[i].data(),
+                    enc_.data(),
+                    text[i].size(),
+                    tag_.data());
+
+    assert(enc_ == enc[i]);
+    assert(tag_ == tag[i]);
+  }
+}
+
+}
@@ -0,0 +1,158 @@
+#pragma once
+#include "test_common.hpp"
+#include <algorithm>
+#include <cassert>
+#include <random>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Splits N -bytes buffer into randomly sized ( possibly empty ) segments
+template<typename S, typename P>
+inline std::vector<S>
+split(P buf, const size_t len, std::mt19937_64& gen)
+{
+  std::vector<S> segs;
+  std::uniform_int_distribution<size_t> dis{ 0, 6 };
+
+  size_t off = 0;
+  while (off < len) {
+    const size_t n = std::min(dis(gen), len - off);
+
+    segs.push_back(S{ buf + off, n });
+    off += n;
+  }
+
+  // trailing empty segment, which must be skipped
+  segs.push_back(S{ buf + off, 0 });
+  return segs;
+}
+
+// Scatter/ gather TinyJambu-{128, 192, 256} authenticated encryption, picking
+// variant at compile-time
+template<const tinyjambu::variant v>
+inline bool
+aead_encrypt_segments(const uint8_t* const __restrict key,
+                      const uint8_t* const __restrict nonce,
+                      const tinyjambu::segments_t data,
+                      const tinyjambu::segments_t text,
+                      const tinyjambu::mut_segments_t cipher,
+                      uint8_t* const __restrict tag)
+{
+  using namespace tinyjambu;
+
+  bool flg = false;
+
+  if constexpr (v == variant::key_128) {
+    flg = tinyjambu_128::encrypt(key, nonce, data, text, cipher, tag);
+  } else if constexpr (v == variant::key_192) {
+    flg = tinyjambu_192::encrypt(key, nonce, data, text, cipher, tag);
+  } else {
+    flg = tinyjambu_256::encrypt(key, nonce, data, text, cipher, tag);
+  }
+
+  return flg;
+}
+
+// Scatter/ gather TinyJambu-{128, 192, 256} verified decryption, picking
+// variant at compile-time
+template<const tinyjambu::variant v>
+inline bool
+aead_decrypt_segments(const uint8_t* const __restrict key,
+                      const uint8_t* const __restrict nonce,
+                      const uint8_t* const __restrict tag,
+                      const tinyjambu::segments_t data,
+                      const tinyjambu::segments_t cipher,
+                      const tinyjambu::mut_segments_t text)
+{
+  using namespace tinyjambu;
+
+  bool flg = false;
+
+  if constexpr (v == variant::key_128) {
+    flg = tinyjambu_128::decrypt(key, nonce, tag, data, cipher, text);
+  } else if constexpr (v == variant::key_192) {
+    flg = tinyjambu_192::decrypt(key, nonce, tag, data, cipher, text);
+  } else {
+    flg = tinyjambu_256::decrypt(key, nonce, tag, data, cipher, text);
+  }
+
+  return flg;
+}
+
+// Test scatter/ gather TinyJambu-{128, 192, 256} AEAD, by splitting associated
+// data, plain text & cipher text into randomly sized segments ( so that 32 -bit
+// words straddle segment boundaries ), ensuring that computed cipher text &
+// authentication tag match with what contiguous `encrypt` computes, then
+// decrypting segments, while decrypting with a mutated tag ( single bit flip )
+// must fail verification & zero plain text segments. Output segments, which
+// are too short, must be rejected, without being written to.
+template<const tinyjambu::variant v>
+void
+scatter_gather(const size_t dt_len, const size_t ct_len)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  std::vector<uint8_t> key(klen), nonce(12), data(dt_len), text(ct_len);
+  std::vector<uint8_t> enc(ct_len), enc_(ct_len), dec(ct_len);
+  std::vector<uint8_t> tag(8), tag_(8);
+
+  random_data(key.data(), klen);
+  random_data(nonce.data(), 12);
+  random_data(data.data(), dt_len);
+  random_data(text.data(), ct_len);
+
+  const uint8_t* const k = key.data();
+  const uint8_t* const n = nonce.data();
+
+  aead_encrypt<v>(
+    k, n, data.data(), dt_len, text.data(), enc.data(), ct_len, tag.data());
+
+  std::random_device rd;
+  std::mt19937_64 gen{ rd() };
+
+  const auto data_s = split<segment_t>(data.data(), dt_len, gen);
+  const auto text_s = split<segment_t>(text.data(), ct_len, gen);
+  const auto enc_s = split<mut_segment_t>(enc_.data(), ct_len, gen);
+
+  bool f = aead_encrypt_segments<v>(k, n, data_s, text_s, enc_s, tag_.data());
+
+  assert(f);
+  assert(enc == enc_);
+  assert(tag == tag_);
+
+  const auto enc_cs = split<segment_t>(enc_.data(), ct_len, gen);
+  const auto dec_s = split<mut_segment_t>(dec.data(), ct_len, gen);
+
+  f = aead_decrypt_segments<v>(k, n, tag.data(), data_s, enc_cs, dec_s);
+
+  assert(f);
+  assert(dec == text);
+
+  tag[0] ^= static_cast<uint8_t>(1);
+  f = aead_decrypt_segments<v>(k, n, tag.data(), data_s, enc_cs, dec_s);
+
+  assert(!f);
+  if (ct_len > 0) {
+    assert(is_zeros(dec.data(), ct_len));
+  }
+
+  // output segments, holding fewer bytes than input ones, must be rejected
+  if (ct_len > 0) {
+    const auto short_s = split<mut_segment_t>(dec.data(), ct_len - 1, gen);
+
+    std::fill(dec.begin(), dec.end(), 0xff);
+
+    f = aead_encrypt_segments<v>(k, n, data_s, text_s, short_s, tag_.data());
+    assert(!f);
+
+    f = aead_decrypt_segments<v>(k, n, tag_.data(), data_s, enc_cs, short_s);
+    assert(!f);
+    assert(std::all_of(
+      dec.begin(), dec.end(), [](const uint8_t b) { return b == 0xff; }));
+  }
+}
+
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "test_common.hpp"
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Test TinyJambu-{128, 192, 256} sealing/ opening, by ensuring that sealed
+// buffer holds same cipher text & authentication tag, as computed by `encrypt`,
+// both when sealing out-of-place & in-place, then opening in-place, which must
+// restore plain text. Besides mutated tag check, opening a buffer, which is too
+// short to hold a tag, must fail.
+template<const tinyjambu::variant v>
+void
+seal(const size_t dt_len, const size_t ct_len)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+  const size_t slen = ct_len + 8;
+
+  std::vector<uint8_t> key(klen), nonce(12), data(dt_len), text(ct_len);
+  std::vector<uint8_t> enc(slen), sealed(slen), buf(slen), dec(ct_len);
+
+  random_data(key.data(), klen);
+  random_data(nonce.data(), 12);
+  random_data(data.data(), dt_len);
+  random_data(text.data(), ct_len);
+
+  const uint8_t* const k = key.data();
+  const uint8_t* const n = nonce.data();
+  const uint8_t* const d = data.data();
+
+  aead_encrypt<v>(
+    k, n, d, dt_len, text.data(), enc.data(), ct_len, enc.data() + ct_len);
+
+  aead_seal<v>(k, n, d, dt_len, text.data(), ct_len, sealed.data());
+  assert(sealed == enc);
+
+  std::copy(text.begin(), text.end(), buf.begin());
+  aead_seal<v>(k, n, d, dt_len, buf.data(), ct_len, buf.data());
+  assert(buf == enc);
+
+  bool f = aead_open<v>(k, n, d, dt_len, buf.data(), slen, buf.data());
+
+  assert(f);
+  assert(std::equal(text.begin(), text.end(), buf.begin()));
+
+  sealed[ct_len] ^= static_cast<uint8_t>(1);
+  f = aead_open<v>(k, n, d, dt_len, sealed.data(), slen, dec.data());
+
+  assert(!f);
+  if (ct_len > 0) {
+    assert(is_zeros(dec.data(), ct_len));
+  }
+
+  f = aead_open<v>(k, n, d, dt_len, sealed.data(), ct_len % 8, dec.data());
+  assert(!f);
+}
+
+}
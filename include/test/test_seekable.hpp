@@ -0,0 +1,172 @@
+#pragma once
+#include "seekable.hpp"
+#include "test_common.hpp"
+#include <cassert>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Test seekable TinyJambu-{128, 192, 256} container, by encrypting N -bytes
+// plain text into a container ( of `chunk_len` -bytes chunks ), storing it in
+// a temporary file & reading random byte ranges back, using `pread`, which
+// must match with plain text, while reading only overlapping chunks. Reading
+// out of bounds must fail, as must reading a chunk, whose cipher text is
+// tampered ( single bit flip ), while other chunks stay readable. A container
+// with tampered header must fail verification of every chunk, while one whose
+// header carries chunk length above `MAX_CHUNK_LEN` must not open at all.
+template<const tinyjambu::variant v>
+void
+seekable(const size_t ct_len, const uint32_t chunk_len)
+{
+  using namespace tinyjambu;
+  using namespace tinyjambu::seekable;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  const size_t clen = container_len(ct_len, chunk_len);
+  const size_t full = chunk_len + chunked::TAG_LEN;
+
+  std::vector<uint8_t> key(klen), prefix(chunked::PREFIX_LEN), text(ct_len);
+  std::vector<uint8_t> enc(clen);
+
+  random_data(key.data(), klen);
+  random_data(prefix.data(), prefix.size());
+  random_data(text.data(), ct_len);
+
+  const uint8_t* const k = key.data();
+
+  const bool e =
+    encrypt<v>(k, prefix.data(), text.data(), ct_len, chunk_len, enc.data());
+  assert(e);
+
+  std::FILE* const fp = std::tmpfile();
+  assert(fp != nullptr);
+
+  const size_t written = std::fwrite(enc.data(), 1, clen, fp);
+  assert(written == clen);
+  std::fflush(fp);
+
+  reader<v> rd{ k, fileno(fp) };
+
+  assert(rd.valid());
+  assert(rd.size() == ct_len);
+  assert(rd.chunk_len() == chunk_len);
+
+  std::random_device rdev;
+  std::mt19937_64 gen{ rdev() };
+
+  for (size_t t = 0; t < 16 && ct_len > 0; t++) {
+    std::uniform_int_distribution<size_t> dis{ 0, ct_len };
+
+    size_t off = dis(gen), end = dis(gen);
+    if (off > end) {
+      std::swap(off, end);
+    }
+
+    std::vector<uint8_t> out(end - off);
+    assert(rd.read(out.data(), out.size(), off));
+    assert(std::equal(out.begin(), out.end(), text.begin() + off));
+  }
+
+  // only overlapping chunks are read, which is checked by counting bytes
+  // read from an in-memory container
+  size_t read_bytes = 0;
+  auto src = [&](void* buf, size_t count, off_t offset) -> ssize_t {
+    const size_t n = std::min<size_t>(count, clen - offset);
+
+    std::memcpy(buf, enc.data() + offset, n);
+    read_bytes += n;
+    return static_cast<ssize_t>(n);
+  };
+
+  {
+    reader<v> rd_{ k, src };
+    assert(rd_.valid());
+
+    if (ct_len > 0) {
+      std::vector<uint8_t> out(1);
+      const size_t off = ct_len / 2;
+
+      read_bytes = 0;
+      assert(rd_.read(out.data(), 1, off));
+      assert(out[0] == text[off]);
+      assert(read_bytes <= full);
+    }
+  }
+
+  // out of bounds
+  {
+    std::vector<uint8_t> out(2);
+    assert(!rd.read(out.data(), 1, ct_len + 1));
+    assert(!rd.read(out.data(), 2, ct_len == 0 ? 0 : ct_len - 1));
+  }
+
+  // tampered chunk
+  if (ct_len > chunk_len) {
+    std::vector<uint8_t> bad(enc);
+    bad[HEADER_LEN + full] ^= static_cast<uint8_t>(1);
+
+    auto bsrc = [&](void* buf, size_t count, off_t offset) -> ssize_t {
+      const size_t n = std::min<size_t>(count, clen - offset);
+
+      std::memcpy(buf, bad.data() + offset, n);
+      return static_cast<ssize_t>(n);
+    };
+
+    reader<v> rd_{ k, bsrc };
+    std::vector<uint8_t> out(chunk_len);
+
+    assert(rd_.valid());
+    assert(rd_.read(out.data(), chunk_len, 0));
+    assert(!rd_.read(out.data(), 1, chunk_len));
+    assert(is_zeros(out.data(), 1));
+  }
+
+  // tampered header, which is still well-formed
+  if (ct_len > 0) {
+    std::vector<uint8_t> bad(enc);
+    bad[20] ^= static_cast<uint8_t>(1);
+
+    auto bsrc = [&](void* buf, size_t count, off_t offset) -> ssize_t {
+      const size_t n = std::min<size_t>(count, clen - offset);
+
+      std::memcpy(buf, bad.data() + offset, n);
+      return static_cast<ssize_t>(n);
+    };
+
+    reader<v> rd_{ k, bsrc };
+    std::vector<uint8_t> out(1);
+
+    assert(rd_.valid());
+    assert(!rd_.read(out.data(), 1, 0));
+  }
+
+  // chunk length above limit, both when encrypting & in a forged header
+  {
+    std::vector<uint8_t> bad(enc);
+    const uint32_t big = MAX_CHUNK_LEN + 1;
+
+    assert(!encrypt<v>(k, prefix.data(), text.data(), ct_len, big, bad.data()));
+    assert(bad == enc);
+
+    for (size_t i = 0; i < 4; i++) {
+      bad[8 + i] = static_cast<uint8_t>(big >> (i << 3));
+    }
+
+    auto bsrc = [&](void* buf, size_t count, off_t offset) -> ssize_t {
+      const size_t n = std::min<size_t>(count, clen - offset);
+
+      std::memcpy(buf, bad.data() + offset, n);
+      return static_cast<ssize_t>(n);
+    };
+
+    reader<v> rd_{ k, bsrc };
+    assert(!rd_.valid());
+  }
+
+  std::fclose(fp);
+}
+
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include "test_common.hpp"
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Test structure-of-arrays TinyJambu-{128, 192, 256} AEAD, by encrypting
+// `msg_cnt` -many records of fixed size, laid out with some padding between
+// them, which must produce same cipher text & authentication tag as calling
+// one-shot `encrypt` on each record, while leaving padding bytes untouched.
+// Then decrypting them in-place, where every third record's tag is mutated,
+// must restore plain text of all other records, while mutated ones must pass
+// mutated tag check.
+template<const tinyjambu::variant v>
+void
+soa(const size_t msg_cnt, const size_t dt_len, const size_t ct_len)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+  constexpr size_t pad = 3;
+
+  const size_t dt_stride = dt_len + pad;
+  const size_t ct_stride = ct_len + pad;
+
+  std::vector<uint8_t> key(klen), nonce(msg_cnt * 12);
+  std::vector<uint8_t> data(msg_cnt * dt_stride), text(msg_cnt * ct_stride);
+  std::vector<uint8_t> enc(msg_cnt * ct_stride, 0xa5);
+  std::vector<uint8_t> tag(msg_cnt * 8), tag_(msg_cnt * 8);
+  std::vector<uint8_t> enc_(ct_len);
+
+  random_data(key.data(), klen);
+  random_data(nonce.data(), nonce.size());
+  random_data(data.data(), data.size());
+  random_data(text.data(), text.size());
+
+  aead_encrypt_soa<v>(key.data(),
+                      nonce.data(),
+                      data.data(),
+                      dt_stride,
+                      dt_len,
+                      text.data(),
+                      enc.data(),
+                      ct_stride,
+                      ct_len,
+                      tag.data(),
+                      msg_cnt);
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    aead_encrypt<v>(key.data(),
+                    nonce.data() + i * 12,
+                    data.data() + i * dt_stride,
+                    dt_len,
+                    text.data() + i * ct_stride,
+                    enc_.data(),
+                    ct_len,
+                    tag_.data() + i * 8);
+
+    const uint8_t* const rec = enc.data() + i * ct_stride;
+
+    assert(std::equal(enc_.begin(), enc_.end(), rec));
+    for (size_t j = ct_len; j < ct_stride; j++) {
+      assert(rec[j] == 0xa5);
+    }
+  }
+
+  assert(tag == tag_);
+
+  for (size_t i = 0; i < msg_cnt; i += 3) {
+    tag[i * 8] ^= static_cast<uint8_t>(1);
+  }
+
+  std::unique_ptr<bool[]> flag = std::make_unique<bool[]>(msg_cnt);
+
+  aead_decrypt_soa<v>(key.data(),
+                      nonce.data(),
+                      tag.data(),
+                      data.data(),
+                      dt_stride,
+                      dt_len,
+                      enc.data(),
+                      enc.data(),
+                      ct_stride,
+                      ct_len,
+                      flag.get(),
+                      msg_cnt);
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    const uint8_t* const dec = enc.data() + i * ct_stride;
+
+    if (i % 3 == 0) {
+      assert(!flag[i]);
+      if (ct_len > 0) {
+        assert(is_zeros(dec, ct_len));
+      }
+    } else {
+      assert(flag[i]);
+      assert(std::equal(dec, dec + ct_len, text.data() + i * ct_stride));
+    }
+  }
+}
+
+}
@@ -0,0 +1,116 @@
+#pragma once
+#include "test_common.hpp"
+#include "test_constexpr.hpp"
+#include <cassert>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Secret key used for testing compile-time key contexts, holding bytes 00, 01,
+// 02, ... ( same as in `known_answer` )
+template<const tinyjambu::variant v>
+constexpr tinyjambu::key_bytes_t<v> STATIC_KEY =
+  counting<tinyjambu::key_word_cnt<v>() << 2>();
+
+// Compile-time check, that encryption under compile-time key context produces
+// known answer, for 16 -bytes associated data & plain text
+template<const tinyjambu::variant v>
+constexpr bool
+check_static_key()
+{
+  using namespace tinyjambu;
+
+  constexpr auto nonce = counting<12>();
+  constexpr auto data = counting<16>();
+  constexpr auto text = counting<16>();
+
+  constexpr auto sealed = [&] {
+    std::array<uint8_t, 24> res{};
+    static_key_context<v, STATIC_KEY<v>>::encrypt(nonce.data(),
+                                                  data.data(),
+                                                  data.size(),
+                                                  text.data(),
+                                                  res.data(),
+                                                  text.size(),
+                                                  res.data() + 16);
+    return res;
+  }();
+
+  static_assert(sealed == known_answer<v, 16, 16>());
+  return true;
+}
+
+static_assert(check_static_key<tinyjambu::variant::key_128>());
+static_assert(check_static_key<tinyjambu::variant::key_192>());
+static_assert(check_static_key<tinyjambu::variant::key_256>());
+
+// Test TinyJambu-{128, 192, 256} compile-time secret key context, computing
+// `fbk` feedback bits per iteration, by encrypting a message, of `dt_len`
+// -bytes associated data & `ct_len` -bytes plain text, ensuring that cipher
+// text & authentication tag matches with what one-shot `encrypt` computes
+// under same key, then decrypting it ( also verify-only ), which must succeed,
+// while mutated tag check passes
+template<const tinyjambu::variant v, const fbk_t fbk>
+void
+static_key(const size_t dt_len, const size_t ct_len)
+{
+  using namespace tinyjambu;
+  using ctx = static_key_context<v, STATIC_KEY<v>, fbk>;
+
+  std::vector<uint8_t> nonce(12), data(dt_len), text(ct_len);
+  std::vector<uint8_t> enc(ct_len), enc_(ct_len), dec(ct_len);
+  std::vector<uint8_t> tag(8), tag_(8);
+
+  random_data(nonce.data(), 12);
+  random_data(data.data(), dt_len);
+  random_data(text.data(), ct_len);
+
+  ctx::encrypt(nonce.data(),
+               data.data(),
+               dt_len,
+               text.data(),
+               enc.data(),
+               ct_len,
+               tag.data());
+  aead_encrypt<v>(STATIC_KEY<v>.data(),
+                  nonce.data(),
+                  data.data(),
+                  dt_len,
+                  text.data(),
+                  enc_.data(),
+                  ct_len,
+                  tag_.data());
+
+  assert(enc == enc_);
+  assert(tag == tag_);
+
+  bool flag = ctx::decrypt(nonce.data(),
+                           tag.data(),
+                           data.data(),
+                           dt_len,
+                           enc.data(),
+                           dec.data(),
+                           ct_len);
+  assert(flag);
+  assert(dec == text);
+  assert(ctx::verify(
+    nonce.data(), tag.data(), data.data(), dt_len, enc.data(), ct_len));
+
+  tag[7] ^= static_cast<uint8_t>(1);
+
+  flag = ctx::decrypt(nonce.data(),
+                      tag.data(),
+                      data.data(),
+                      dt_len,
+                      enc.data(),
+                      dec.data(),
+                      ct_len);
+  assert(!flag);
+  assert(!ctx::verify(
+    nonce.data(), tag.data(), data.data(), dt_len, enc.data(), ct_len));
+  if (ct_len > 0) {
+    assert(is_zeros(dec.data(), ct_len));
+  }
+}
+
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "test_common.hpp"
+#include <algorithm>
+#include <cassert>
+#include <random>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Feeds N -bytes input to `fn` in randomly sized ( possibly empty ) pieces
+template<typename F>
+inline void
+in_pieces(const size_t len, std::mt19937_64& gen, F fn)
+{
+  std::uniform_int_distribution<size_t> dis{ 0, 9 };
+
+  size_t off = 0;
+  while (off < len) {
+    const size_t n = std::min(dis(gen), len - off);
+
+    fn(off, n);
+    off += n;
+  }
+}
+
+// Test incremental TinyJambu-{128, 192, 256} AEAD, by feeding associated data
+// & plain text in randomly sized pieces, ensuring that cipher text &
+// authentication tag match with what one-shot `encrypt` computes, then
+// decrypting ( in-place ) in differently sized pieces, which must restore plain
+// text, while verifying a mutated tag ( single bit flip ) must fail
+template<const tinyjambu::variant v>
+void
+stream(const size_t dt_len, const size_t ct_len)
+{
+  using namespace tinyjambu;
+  using enc_stream_t = tinyjambu::stream<v, direction_t::encrypt>;
+  using dec_stream_t = tinyjambu::stream<v, direction_t::decrypt>;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  std::vector<uint8_t> key(klen), nonce(12), data(dt_len), text(ct_len);
+  std::vector<uint8_t> enc(ct_len), enc_(ct_len);
+  std::vector<uint8_t> tag(8), tag_(8);
+
+  random_data(key.data(), klen);
+  random_data(nonce.data(), 12);
+  random_data(data.data(), dt_len);
+  random_data(text.data(), ct_len);
+
+  const uint8_t* const k = key.data();
+  const uint8_t* const n = nonce.data();
+  const uint8_t* const d = data.data();
+
+  aead_encrypt<v>(k, n, d, dt_len, text.data(), enc.data(), ct_len, tag.data());
+
+  std::random_device rd;
+  std::mt19937_64 gen{ rd() };
+
+  enc_stream_t es{ k, n };
+
+  in_pieces(dt_len, gen, [&](size_t off, size_t len) {
+    es.update_ad(d + off, len);
+  });
+  in_pieces(ct_len, gen, [&](size_t off, size_t len) {
+    es.update(text.data() + off, enc_.data() + off, len);
+  });
+  es.finalize(tag_.data());
+
+  assert(enc == enc_);
+  assert(tag == tag_);
+
+  dec_stream_t ds{ k, n };
+
+  in_pieces(dt_len, gen, [&](size_t off, size_t len) {
+    ds.update_ad(d + off, len);
+  });
+  in_pieces(ct_len, gen, [&](size_t off, size_t len) {
+    ds.update(enc_.data() + off, enc_.data() + off, len);
+  });
+
+  assert(ds.verify(tag.data()));
+  assert(enc_ == text);
+
+  dec_stream_t ds_{ k, n };
+
+  tag[0] ^= static_cast<uint8_t>(1);
+
+  ds_.update_ad(d, dt_len);
+  ds_.update(enc.data(), enc_.data(), ct_len);
+
+  assert(!ds_.verify(tag.data()));
+}
+
+}
@@ -3,3 +3,21 @@
 #include "test_tinyjambu_128.hpp"
 #include "test_tinyjambu_192.hpp"
 #include "test_tinyjambu_256.hpp"
+#include "test_tinyjambu_batch.hpp"
+#include "test_soa.hpp"
+#include "test_key_context.hpp"
+#include "test_feedback.hpp"
+#include "test_inplace.hpp"
+#include "test_scatter_gather.hpp"
+#include "test_stream.hpp"
+#include "test_verify.hpp"
+#include "test_seal.hpp"
+#include "test_parallel.hpp"
+#include "test_chunked.hpp"
+#include "test_seekable.hpp"
+#include "test_async.hpp"
+#include "test_mb.hpp"
+#include "test_pipeline.hpp"
+#include "test_fixed.hpp"
+#include "test_constexpr.hpp"
+#include "test_static_key.hpp"
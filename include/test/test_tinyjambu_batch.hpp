@@ -0,0 +1,209 @@
+#pragma once
+#include "test_common.hpp"
+#include <cassert>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Batched authenticated encryption of many messages, using SIMD lanes when
+// `ways` is 0, otherwise interleaving `ways` -many messages in general purpose
+// registers
+template<const tinyjambu::variant v, const size_t ways>
+inline void
+encrypt_many(const uint8_t* const* const __restrict key,
+             const uint8_t* const* const __restrict nonce,
+             const uint8_t* const* const __restrict data,
+             const size_t* const __restrict data_len,
+             const uint8_t* const* const __restrict text,
+             uint8_t* const* const __restrict cipher,
+             const size_t* const __restrict ct_len,
+             uint8_t* const* const __restrict tag,
+             const size_t n)
+{
+  using namespace tinyjambu;
+
+  if constexpr (v == variant::key_128) {
+    if constexpr (ways == 0) {
+      tinyjambu_128::encrypt_batch(
+        key, nonce, data, data_len, text, cipher, ct_len, tag, n);
+    } else {
+      tinyjambu_128::encrypt_interleaved<ways>(
+        key, nonce, data, data_len, text, cipher, ct_len, tag, n);
+    }
+  } else if constexpr (v == variant::key_192) {
+    if constexpr (ways == 0) {
+      tinyjambu_192::encrypt_batch(
+        key, nonce, data, data_len, text, cipher, ct_len, tag, n);
+    } else {
+      tinyjambu_192::encrypt_interleaved<ways>(
+        key, nonce, data, data_len, text, cipher, ct_len, tag, n);
+    }
+  } else {
+    if constexpr (ways == 0) {
+      tinyjambu_256::encrypt_batch(
+        key, nonce, data, data_len, text, cipher, ct_len, tag, n);
+    } else {
+      tinyjambu_256::encrypt_interleaved<ways>(
+        key, nonce, data, data_len, text, cipher, ct_len, tag, n);
+    }
+  }
+}
+
+// Batched verified decryption of many messages, using SIMD lanes when `ways`
+// is 0, otherwise interleaving `ways` -many messages in general purpose
+// registers
+template<const tinyjambu::variant v, const size_t ways>
+inline void
+decrypt_many(const uint8_t* const* const __restrict key,
+             const uint8_t* const* const __restrict nonce,
+             const uint8_t* const* const __restrict tag,
+             const uint8_t* const* const __restrict data,
+             const size_t* const __restrict data_len,
+             const uint8_t* const* const __restrict cipher,
+             uint8_t* const* const __restrict text,
+             const size_t* const __restrict ct_len,
+             bool* const __restrict flag,
+             const size_t n)
+{
+  using namespace tinyjambu;
+
+  if constexpr (v == variant::key_128) {
+    if constexpr (ways == 0) {
+      tinyjambu_128::decrypt_batch(
+        key, nonce, tag, data, data_len, cipher, text, ct_len, flag, n);
+    } else {
+      tinyjambu_128::decrypt_interleaved<ways>(
+        key, nonce, tag, data, data_len, cipher, text, ct_len, flag, n);
+    }
+  } else if constexpr (v == variant::key_192) {
+    if constexpr (ways == 0) {
+      tinyjambu_192::decrypt_batch(
+        key, nonce, tag, data, data_len, cipher, text, ct_len, flag, n);
+    } else {
+      tinyjambu_192::decrypt_interleaved<ways>(
+        key, nonce, tag, data, data_len, cipher, text, ct_len, flag, n);
+    }
+  } else {
+    if constexpr (ways == 0) {
+      tinyjambu_256::decrypt_batch(
+        key, nonce, tag, data, data_len, cipher, text, ct_len, flag, n);
+    } else {
+      tinyjambu_256::decrypt_interleaved<ways>(
+        key, nonce, tag, data, data_len, cipher, text, ct_len, flag, n);
+    }
+  }
+}
+
+// Test lane-parallel batched TinyJambu-{128, 192, 256} AEAD by encrypting
+// `msg_cnt` -many messages of differing lengths, both using batched routine &
+// calling one-shot `encrypt` on each message, then comparing outputs, before
+// attempting batched decryption, where every third message's tag is mutated (
+// single bit flip ), which must fail verification. When `ways` is non-zero,
+// same is tested for interleaved routines, instead of SIMD lane based ones.
+template<const tinyjambu::variant v, const size_t ways = 0>
+void
+batch(const size_t msg_cnt, const size_t max_dt_len, const size_t max_ct_len)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  std::vector<std::vector<uint8_t>> key(msg_cnt), nonce(msg_cnt);
+  std::vector<std::vector<uint8_t>> data(msg_cnt), text(msg_cnt);
+  std::vector<std::vector<uint8_t>> enc(msg_cnt), dec(msg_cnt);
+  std::vector<std::vector<uint8_t>> tag(msg_cnt), tag_(msg_cnt);
+  std::vector<size_t> dt_len(msg_cnt), ct_len(msg_cnt);
+
+  std::vector<const uint8_t*> key_p(msg_cnt), nonce_p(msg_cnt);
+  std::vector<const uint8_t*> data_p(msg_cnt), text_p(msg_cnt);
+  std::vector<const uint8_t*> enc_cp(msg_cnt), tag_cp(msg_cnt);
+  std::vector<uint8_t*> enc_p(msg_cnt), dec_p(msg_cnt), tag_p(msg_cnt);
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    dt_len[i] = (i * 7ul) % (max_dt_len + 1);
+    ct_len[i] = (i * 13ul) % (max_ct_len + 1);
+
+    key[i].resize(klen);
+    nonce[i].resize(12);
+    data[i].resize(dt_len[i]);
+    text[i].resize(ct_len[i]);
+    enc[i].resize(ct_len[i]);
+    dec[i].resize(ct_len[i]);
+    tag[i].resize(8);
+    tag_[i].resize(8);
+
+    random_data(key[i].data(), klen);
+    random_data(nonce[i].data(), 12);
+    random_data(data[i].data(), dt_len[i]);
+    random_data(text[i].data(), ct_len[i]);
+
+    key_p[i] = key[i].data();
+    nonce_p[i] = nonce[i].data();
+    data_p[i] = data[i].data();
+    text_p[i] = text[i].data();
+    enc_p[i] = enc[i].data();
+    enc_cp[i] = enc[i].data();
+    dec_p[i] = dec[i].data();
+    tag_p[i] = tag[i].data();
+    tag_cp[i] = tag[i].data();
+  }
+
+  encrypt_many<v, ways>(key_p.data(),
+                        nonce_p.data(),
+                        data_p.data(),
+                        dt_len.data(),
+                        text_p.data(),
+                        enc_p.data(),
+                        ct_len.data(),
+                        tag_p.data(),
+                        msg_cnt);
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    std::vector<uint8_t> enc_(ct_len[i]);
+
+    aead_encrypt<v>(key_p[i],
+                    nonce_p[i],
+                    data_p[i],
+                    dt_len[i],
+                    text_p[i],
+                    enc_.data(),
+                    ct_len[i],
+                    tag_[i].data());
+
+    assert(enc_ == enc[i]);
+    assert(tag_[i] == tag[i]);
+
+    if (i % 3ul == 0ul) {
+      tag[i][0] ^= static_cast<uint8_t>(1);
+    }
+  }
+
+  bool* flag_p = static_cast<bool*>(std::malloc(msg_cnt * sizeof(bool)));
+
+  decrypt_many<v, ways>(key_p.data(),
+                        nonce_p.data(),
+                        tag_cp.data(),
+                        data_p.data(),
+                        dt_len.data(),
+                        enc_cp.data(),
+                        dec_p.data(),
+                        ct_len.data(),
+                        flag_p,
+                        msg_cnt);
+
+  for (size_t i = 0; i < msg_cnt; i++) {
+    if (i % 3ul == 0ul) {
+      assert(!flag_p[i]);
+      if (ct_len[i] > 0) {
+        assert(is_zeros(dec[i].data(), ct_len[i]));
+      }
+    } else {
+      assert(flag_p[i]);
+      assert(dec[i] == text[i]);
+    }
+  }
+
+  std::free(flag_p);
+}
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "test_common.hpp"
+#include <cassert>
+#include <vector>
+
+namespace test_tinyjambu {
+
+// Test verify-only TinyJambu-{128, 192, 256} decryption, by ensuring that it
+// returns same verification flag as `decrypt` ( and `key_context::verify` ),
+// both for authentic input & when either of tag, associated data or cipher text
+// is mutated ( single bit flip )
+template<const tinyjambu::variant v>
+void
+verify(const size_t dt_len, const size_t ct_len)
+{
+  using namespace tinyjambu;
+
+  constexpr size_t klen = key_word_cnt<v>() << 2;
+
+  std::vector<uint8_t> key(klen), nonce(12), data(dt_len), text(ct_len);
+  std::vector<uint8_t> enc(ct_len), dec(ct_len), tag(8);
+
+  random_data(key.data(), klen);
+  random_data(nonce.data(), 12);
+  random_data(data.data(), dt_len);
+  random_data(text.data(), ct_len);
+
+  const uint8_t* const k = key.data();
+  const uint8_t* const n = nonce.data();
+
+  aead_encrypt<v>(
+    k, n, data.data(), dt_len, text.data(), enc.data(), ct_len, tag.data());
+
+  const tinyjambu::key_context<v> kctx{ k };
+
+  for (mutate_t m : { mutate_t::none,
+                      mutate_t::tag,
+                      mutate_t::data,
+                      mutate_t::enc }) {
+    std::vector<uint8_t> tag_(tag), data_(data), enc_(enc);
+
+    if (m == mutate_t::tag) {
+      tag_[0] ^= static_cast<uint8_t>(1);
+    } else if (m == mutate_t::data && dt_len > 0) {
+      data_[dt_len - 1] ^= static_cast<uint8_t>(0x80);
+    } else if (m == mutate_t::enc && ct_len > 0) {
+      enc_[ct_len - 1] ^= static_cast<uint8_t>(0x80);
+    }
+
+    const uint8_t* const t = tag_.data();
+    const uint8_t* const d = data_.data();
+    const uint8_t* const c = enc_.data();
+
+    const bool f0 = aead_decrypt<v>(k, n, t, d, dt_len, c, dec.data(), ct_len);
+    const bool f1 = aead_verify<v>(k, n, t, d, dt_len, c, ct_len);
+    const bool f2 = kctx.verify(n, t, d, dt_len, c, ct_len);
+
+    assert(f0 == f1);
+    assert(f0 == f2);
+    assert(f0 == (m == mutate_t::none ||
+                  (m == mutate_t::data && dt_len == 0) ||
+                  (m == mutate_t::enc && ct_len == 0)));
+  }
+}
+
+}
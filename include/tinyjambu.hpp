@@ -49,12 +49,144 @@ constexpr uint32_t FRAMEBITS_CT = 0x50u;
 // == hex(7 << 4)
 constexpr uint32_t FRAMEBITS_TAG = 0x70u;
 
+// Number of 32 -bit words in {128, 192, 256} -bit secret key
+template<const variant v>
+static inline constexpr size_t
+key_word_cnt()
+{
+  if constexpr (v == variant::key_128) {
+    return 4ul;
+  } else if constexpr (v == variant::key_192) {
+    return 6ul;
+  } else {
+    return 8ul;
+  }
+}
+
+// Interprets {16, 24, 32} little endian secret key bytes as {4, 6, 8} -many 32
+// -bit words, which are consumed by `state_update`
+template<const variant v>
+static inline constexpr void
+load_key(const uint8_t* const __restrict key, // {128, 192, 256} -bit secret key
+         uint32_t* const __restrict key_      // {4, 6, 8} -many key words
+)
+{
+  for (size_t i = 0; i < key_word_cnt<v>(); i++) {
+    key_[i] = from_le_bytes(key + (i << 2));
+  }
+}
+
+// Compares computed & expected 64 -bit authentication tags, without branching
+// on tag bytes, returning truth value if they're not equal
+static inline constexpr bool
+mismatch(const uint8_t* const __restrict tag_a, // 64 -bit authentication tag
+         const uint8_t* const __restrict tag_b  // 64 -bit authentication tag
+)
+{
+  bool flag = false;
+  for (size_t i = 0; i < 8; i++) {
+    flag |= static_cast<bool>(tag_a[i] ^ tag_b[i]);
+  }
+  return flag;
+}
+
+// Zeroes N -many bytes, using `std::memset` at runtime, while falling back to
+// byte-wise stores during constant evaluation
+static inline constexpr void
+wipe(uint8_t* const bytes, const size_t len)
+{
+  if (std::is_constant_evaluated()) {
+    for (size_t i = 0; i < len; i++) {
+      bytes[i] = 0;
+    }
+  } else {
+    std::memset(bytes, 0, len);
+  }
+}
+
+// Number of rounds of `state_update`, used during key setup, processing of
+// plain/ cipher text & generation of first half of authentication tag, which
+// is 1024/ 1152/ 1280 for TinyJambu-{128, 192, 256}
+template<const variant v>
+static inline constexpr size_t
+key_rounds()
+{
+  if constexpr (v == variant::key_128) {
+    return 1024ul;
+  } else if constexpr (v == variant::key_192) {
+    return 1152ul;
+  } else {
+    return 1280ul;
+  }
+}
+
+// Updates 128 -bit permutation state `rounds` -many times, using `state_update`
+// routine of TinyJambu variant `v`, computing `fbk` feedback bits per iteration
+template<const variant v,
+         const size_t rounds,
+         const fbk_t fbk = DEFAULT_FBK,
+         typename T = uint32_t>
+static inline constexpr void
+permute(T* const __restrict state,    // 128 -bit state
+        const T* const __restrict key // {128, 192, 256} -bit secret key
+)
+{
+  if constexpr (v == variant::key_128) {
+    tinyjambu_128::state_update<rounds, fbk>(state, key);
+  } else if constexpr (v == variant::key_192) {
+    tinyjambu_192::state_update<rounds, fbk>(state, key);
+  } else {
+    tinyjambu_256::state_update<rounds, fbk>(state, key);
+  }
+}
+
+// Key setup, which initializes 128 -bit permutation state with zero bits &
+// then updates it using {128, 192, 256} -bit secret key. Resulting state only
+// depends on secret key, so it can be computed once & reused for all messages
+// encrypted/ decrypted under same key.
+//
+// See section 3.3.1 of TinyJambu specification
+// https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/tinyjambu-spec-final.pdf
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+static inline constexpr void
+setup_key(uint32_t* const __restrict state,    // 128 -bit state
+          const uint32_t* const __restrict key // {128, 192, 256} -bit secret key
+)
+{
+  // Initialize state array with 128 zero bits - just to be safe !
+  for (size_t i = 0; i < 4; i++) {
+    state[i] = 0u;
+  }
+
+  permute<v, key_rounds<v>(), fbk>(state, key);
+}
+
+// Mixes one 32 -bit word of public message nonce into permutation state, which
+// is invoked thrice during nonce setup
+//
+// See section 3.3.1 of TinyJambu specification
+// https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/tinyjambu-spec-final.pdf
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+static inline constexpr void
+setup_nonce_word(
+  uint32_t* const __restrict state,     // 128 -bit state
+  const uint32_t* const __restrict key, // {128, 192, 256} -bit secret key
+  const uint8_t* const __restrict word  // 4 -bytes of public message nonce
+)
+{
+  state[1] ^= FRAMEBITS_NONCE;
+
+  permute<v, 640ul, fbk>(state, key);
+
+  state[3] ^= from_le_bytes(word);
+}
+
 // Initializes 128 -bit permutation state using {128, 192, 256} -bit secret key
 // & 96 -bit public message nonce
 //
 // See section 3.3.1 of TinyJambu specification
 // https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/tinyjambu-spec-final.pdf
-template<const variant v>
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
 static inline constexpr void
 initialize(
   uint32_t* const __restrict state,     // 128 -bit state
@@ -62,31 +194,12 @@ initialize(
   const uint8_t* const __restrict nonce // 96 -bit public message nonce
 )
 {
-  // Initialize state array with 128 zero bits - just to be safe !
-  std::memset(state, 0, 16);
-
   // key setup
-  if (std::is_constant_evaluated() && (v == variant::key_128)) {
-    tinyjambu_128::state_update<1024ul>(state, key);
-  } else if (std::is_constant_evaluated() && (v == variant::key_192)) {
-    tinyjambu_192::state_update<1152ul>(state, key);
-  } else if (std::is_constant_evaluated() && (v == variant::key_256)) {
-    tinyjambu_256::state_update<1280ul>(state, key);
-  }
+  setup_key<v, fbk>(state, key);
 
   // nonce setup
   for (size_t i = 0; i < 3; i++) {
-    state[1] ^= FRAMEBITS_NONCE;
-
-    if (std::is_constant_evaluated() && (v == variant::key_128)) {
-      tinyjambu_128::state_update<640ul>(state, key);
-    } else if (std::is_constant_evaluated() && (v == variant::key_192)) {
-      tinyjambu_192::state_update<640ul>(state, key);
-    } else if (std::is_constant_evaluated() && (v == variant::key_256)) {
-      tinyjambu_256::state_update<640ul>(state, key);
-    }
-
-    state[3] ^= from_le_bytes(nonce + i * 4);
+    setup_nonce_word<v, fbk>(state, key, nonce + i * 4);
   }
 }
 
@@ -97,7 +210,7 @@ initialize(
 //
 // See section 3.3.2 of TinyJambu specification
 // https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/tinyjambu-spec-final.pdf
-template<const variant v>
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
 static inline constexpr void
 process_associated_data(
   uint32_t* const __restrict state,     // 128 -bit state
@@ -106,39 +219,25 @@ process_associated_data(
   const size_t data_len                 // # -of associated data bytes
 )
 {
+  const size_t full_byte_cnt = data_len & (~3ul);
   const size_t part_byte_cnt = data_len & 3ul;
 
-  size_t b_off = 0ul;
-  while (b_off < data_len) {
+  // full 32 -bit words, read using fixed-width loads
+  for (size_t b_off = 0; b_off < full_byte_cnt; b_off += 4) {
     state[1] ^= FRAMEBITS_AD;
 
-    if (std::is_constant_evaluated() && (v == variant::key_128)) {
-      tinyjambu_128::state_update<640ul>(state, key);
-    } else if (std::is_constant_evaluated() && (v == variant::key_192)) {
-      tinyjambu_192::state_update<640ul>(state, key);
-    } else if (std::is_constant_evaluated() && (v == variant::key_256)) {
-      tinyjambu_256::state_update<640ul>(state, key);
-    }
-
-    const size_t take = std::min(4ul, data_len - b_off);
-
-    uint32_t word = 0u;
+    permute<v, 640ul, fbk>(state, key);
 
-#if defined __x86_64__ && !defined __clang__ && defined __GNUG__ &&            \
-  __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
-
-    std::memcpy(&word, data + b_off, take);
-
-#else
+    state[3] ^= from_le_bytes(data + b_off);
+  }
 
-    for (size_t i = 0; i < take; i++) {
-      word |= static_cast<uint32_t>(data[b_off + i]) << (i << 3);
-    }
+  // remaining partial word ( if any ), of 1 to 3 bytes
+  if (part_byte_cnt > 0ul) {
+    state[1] ^= FRAMEBITS_AD;
 
-#endif
+    permute<v, 640ul, fbk>(state, key);
 
-    state[3] ^= word;
-    b_off += take;
+    state[3] ^= from_le_bytes(data + full_byte_cnt, part_byte_cnt);
   }
 
   state[1] ^= static_cast<uint32_t>(part_byte_cnt);
@@ -147,135 +246,137 @@ process_associated_data(
 // Process N -many plain text bytes and computes equal number of cipher text
 // bytes, using TinyJambu-{128, 192, 256} AEAD
 //
+// Note, `text` & `cipher` may point to same memory ( for in-place encryption ),
+// because each 32 -bit word is read before respective cipher text word is
+// written back. Partially overlapping buffers are not supported.
+//
 // See section 3.3.3 of TinyJambu specification
 // https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/tinyjambu-spec-final.pdf
-template<const variant v>
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
 static inline constexpr void
 process_plain_text(
   uint32_t* const __restrict state,     // 128 -bit state
   const uint32_t* const __restrict key, // {128, 192, 256} -bit secret key
-  const uint8_t* const __restrict text, // N -bytes plain text
-  uint8_t* const __restrict cipher,     // N -bytes cipher text ( output )
+  const uint8_t* const text,            // N -bytes plain text
+  uint8_t* const cipher,                // N -bytes cipher text ( output )
   const size_t ct_len                   // # -of plain/ cipher text bytes
 )
 {
+  const size_t full_byte_cnt = ct_len & (~3ul);
   const size_t part_byte_cnt = ct_len & 3ul;
 
-  size_t b_off = 0ul;
-  while (b_off < ct_len) {
+  // full 32 -bit words, read/ written using fixed-width loads/ stores
+  for (size_t b_off = 0; b_off < full_byte_cnt; b_off += 4) {
     state[1] ^= FRAMEBITS_CT;
 
-    if (std::is_constant_evaluated() && (v == variant::key_128)) {
-      tinyjambu_128::state_update<1024ul>(state, key);
-    } else if (std::is_constant_evaluated() && (v == variant::key_192)) {
-      tinyjambu_192::state_update<1152ul>(state, key);
-    } else if (std::is_constant_evaluated() && (v == variant::key_256)) {
-      tinyjambu_256::state_update<1280ul>(state, key);
-    }
-
-    const size_t take = std::min(4ul, ct_len - b_off);
-
-    uint32_t word = 0u;
-
-#if defined __x86_64__ && !defined __clang__ && defined __GNUG__ &&            \
-  __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
-
-    std::memcpy(&word, text + b_off, take);
+    permute<v, key_rounds<v>(), fbk>(state, key);
 
-#else
-
-    for (size_t i = 0; i < take; i++) {
-      word |= static_cast<uint32_t>(text[b_off + i]) << (i << 3);
-    }
-
-#endif
+    const uint32_t word = from_le_bytes(text + b_off);
 
     state[3] ^= word;
-    const uint32_t enc = state[2] ^ word;
-
-#if defined __x86_64__ && !defined __clang__ && defined __GNUG__ &&            \
-  __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
-
-    std::memcpy(cipher + b_off, &enc, take);
+    to_le_bytes(state[2] ^ word, cipher + b_off);
+  }
 
-#else
+  // remaining partial word ( if any ), of 1 to 3 bytes
+  if (part_byte_cnt > 0ul) {
+    state[1] ^= FRAMEBITS_CT;
 
-    for (size_t i = 0; i < take; i++) {
-      cipher[b_off + i] = static_cast<uint8_t>(enc >> (i << 3));
-    }
+    permute<v, key_rounds<v>(), fbk>(state, key);
 
-#endif
+    const uint32_t word = from_le_bytes(text + full_byte_cnt, part_byte_cnt);
 
-    b_off += take;
+    state[3] ^= word;
+    to_le_bytes(state[2] ^ word, cipher + full_byte_cnt, part_byte_cnt);
   }
 
   state[1] ^= static_cast<uint32_t>(part_byte_cnt);
 }
 
 // Process N -many cipher text bytes and computes equal number of plain text
-// bytes, using TinyJambu-128 AEAD
+// bytes, using TinyJambu-{128, 192, 256} AEAD
+//
+// Note, `cipher` & `text` may point to same memory ( for in-place decryption ),
+// because each 32 -bit word is read before respective plain text word is
+// written back. Partially overlapping buffers are not supported.
 //
 // See section 3.3.5 of TinyJambu specification
 // https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/tinyjambu-spec-final.pdf
-template<const variant v>
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
 static inline constexpr void
 process_cipher_text(
-  uint32_t* const __restrict state,       // 128 -bit state
-  const uint32_t* const __restrict key,   // {128, 192, 256} -bit secret key
-  const uint8_t* const __restrict cipher, // N -bytes cipher text
-  uint8_t* const __restrict text,         // N -bytes plain text ( output )
-  const size_t ct_len                     // # -of cipher/ plain text bytes
+  uint32_t* const __restrict state,     // 128 -bit state
+  const uint32_t* const __restrict key, // {128, 192, 256} -bit secret key
+  const uint8_t* const cipher,          // N -bytes cipher text
+  uint8_t* const text,                  // N -bytes plain text ( output )
+  const size_t ct_len                   // # -of cipher/ plain text bytes
 )
 {
+  const size_t full_byte_cnt = ct_len & (~3ul);
   const size_t part_byte_cnt = ct_len & 3ul;
 
-  size_t b_off = 0ul;
-  while (b_off < ct_len) {
+  // full 32 -bit words, read/ written using fixed-width loads/ stores
+  for (size_t b_off = 0; b_off < full_byte_cnt; b_off += 4) {
     state[1] ^= FRAMEBITS_CT;
 
-    if (std::is_constant_evaluated() && (v == variant::key_128)) {
-      tinyjambu_128::state_update<1024ul>(state, key);
-    } else if (std::is_constant_evaluated() && (v == variant::key_192)) {
-      tinyjambu_192::state_update<1152ul>(state, key);
-    } else if (std::is_constant_evaluated() && (v == variant::key_256)) {
-      tinyjambu_256::state_update<1280ul>(state, key);
-    }
+    permute<v, key_rounds<v>(), fbk>(state, key);
 
-    const size_t take = std::min(4ul, ct_len - b_off);
+    const uint32_t dec = state[2] ^ from_le_bytes(cipher + b_off);
 
-    uint32_t word = 0u;
+    state[3] ^= dec;
+    to_le_bytes(dec, text + b_off);
+  }
 
-#if defined __x86_64__ && !defined __clang__ && defined __GNUG__ &&            \
-  __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  // remaining partial word ( if any ), of 1 to 3 bytes
+  if (part_byte_cnt > 0ul) {
+    state[1] ^= FRAMEBITS_CT;
 
-    std::memcpy(&word, cipher + b_off, take);
+    permute<v, key_rounds<v>(), fbk>(state, key);
 
-#else
+    const uint32_t word = from_le_bytes(cipher + full_byte_cnt, part_byte_cnt);
+    const uint32_t dec = state[2] ^ word;
+    const uint32_t mask = 0xffffffffu >> ((4ul - part_byte_cnt) << 3);
 
-    for (size_t i = 0; i < take; i++) {
-      word |= static_cast<uint32_t>(cipher[b_off + i]) << (i << 3);
-    }
+    state[3] ^= (dec & mask);
+    to_le_bytes(dec, text + full_byte_cnt, part_byte_cnt);
+  }
 
-#endif
+  state[1] ^= static_cast<uint32_t>(part_byte_cnt);
+}
 
-    const uint32_t dec = state[2] ^ word;
-    const uint32_t mask = 0xffffffffu >> ((4ul - take) << 3);
-    state[3] ^= (dec & mask);
+// Absorbs N -many cipher text bytes, running same state updates as
+// `process_cipher_text`, but decrypted words are only mixed into permutation
+// state & never written out, so that authenticity of cipher text can be checked
+// without any plain text buffer
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
+static inline constexpr void
+authenticate_cipher_text(
+  uint32_t* const __restrict state,       // 128 -bit state
+  const uint32_t* const __restrict key,   // {128, 192, 256} -bit secret key
+  const uint8_t* const __restrict cipher, // N -bytes cipher text
+  const size_t ct_len                     // # -of cipher text bytes
+)
+{
+  const size_t full_byte_cnt = ct_len & (~3ul);
+  const size_t part_byte_cnt = ct_len & 3ul;
 
-#if defined __x86_64__ && !defined __clang__ && defined __GNUG__ &&            \
-  __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  for (size_t b_off = 0; b_off < full_byte_cnt; b_off += 4) {
+    state[1] ^= FRAMEBITS_CT;
 
-    std::memcpy(text + b_off, &dec, take);
+    permute<v, key_rounds<v>(), fbk>(state, key);
 
-#else
+    state[3] ^= state[2] ^ from_le_bytes(cipher + b_off);
+  }
 
-    for (size_t i = 0; i < take; i++) {
-      text[b_off + i] = static_cast<uint8_t>(dec >> (i << 3));
-    }
+  // remaining partial word ( if any ), of 1 to 3 bytes
+  if (part_byte_cnt > 0ul) {
+    state[1] ^= FRAMEBITS_CT;
+
+    permute<v, key_rounds<v>(), fbk>(state, key);
 
-#endif
+    const uint32_t word = from_le_bytes(cipher + full_byte_cnt, part_byte_cnt);
+    const uint32_t mask = 0xffffffffu >> ((4ul - part_byte_cnt) << 3);
 
-    b_off += take;
+    state[3] ^= (state[2] ^ word) & mask;
   }
 
   state[1] ^= static_cast<uint32_t>(part_byte_cnt);
@@ -285,7 +386,7 @@ process_cipher_text(
 //
 // See section 3.3.4 of TinyJambu specification
 // https://csrc.nist.gov/CSRC/media/Projects/lightweight-cryptography/documents/finalist-round/updated-spec-doc/tinyjambu-spec-final.pdf
-template<const variant v>
+template<const variant v, const fbk_t fbk = DEFAULT_FBK>
 static inline constexpr void
 finalize(
   uint32_t* const __restrict state,     // 128 -bit state
@@ -295,25 +396,13 @@ finalize(
 {
   state[1] ^= FRAMEBITS_TAG;
 
-  if (std::is_constant_evaluated() && (v == variant::key_128)) {
-    tinyjambu_128::state_update<1024ul>(state, key);
-  } else if (std::is_constant_evaluated() && (v == variant::key_192)) {
-    tinyjambu_192::state_update<1152ul>(state, key);
-  } else if (std::is_constant_evaluated() && (v == variant::key_256)) {
-    tinyjambu_256::state_update<1280ul>(state, key);
-  }
+  permute<v, key_rounds<v>(), fbk>(state, key);
 
   to_le_bytes(state[2], tag);
 
   state[1] ^= FRAMEBITS_TAG;
 
-  if constexpr (v == variant::key_128) {
-    tinyjambu_128::state_update<640ul>(state, key);
-  } else if constexpr (v == variant::key_192) {
-    tinyjambu_192::state_update<640ul>(state, key);
-  } else {
-    tinyjambu_256::state_update<640ul>(state, key);
-  }
+  permute<v, 640ul, fbk>(state, key);
 
   to_le_bytes(state[2], tag + 4);
 }
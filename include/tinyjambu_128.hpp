@@ -1,21 +1,58 @@
 #pragma once
+#include "fixed.hpp"
+#include "key_context.hpp"
+#include "scatter_gather.hpp"
+#include "stream.hpp"
 #include "tinyjambu.hpp"
+#include "tinyjambu_batch.hpp"
 
 // TinyJambu-128 Authenticated Encryption with Associated Data Implementation
 namespace tinyjambu_128 {
 
+// TinyJambu-128 secret key context, which runs key setup only once & reuses
+// resulting permutation state for each message encrypted/ decrypted under it
+using key_context = tinyjambu::key_context<tinyjambu::variant::key_128>;
+
+// TinyJambu-128 secret key & nonce prefix context, which also caches state
+// after absorbing first 8 -bytes of nonce, for counter-style nonces
+using nonce_prefix_context =
+  tinyjambu::nonce_prefix_context<tinyjambu::variant::key_128>;
+
+// TinyJambu-128 compile-time secret key context, whose key words & post key
+// setup state are computed by compiler
+template<const tinyjambu::key_bytes_t<tinyjambu::variant::key_128> key,
+         const fbk_t fbk = fbk_t::fbk_all>
+using static_key_context =
+  tinyjambu::static_key_context<tinyjambu::variant::key_128, key, fbk>;
+
+// Incremental TinyJambu-128 authenticated encryption, taking associated data &
+// plain text in arbitrary sized pieces
+using encrypt_stream = tinyjambu::stream<tinyjambu::variant::key_128,
+                                         tinyjambu::direction_t::encrypt>;
+
+// Incremental TinyJambu-128 verified decryption, taking associated data &
+// cipher text in arbitrary sized pieces
+using decrypt_stream = tinyjambu::stream<tinyjambu::variant::key_128,
+                                         tinyjambu::direction_t::decrypt>;
+
 // TinyJambu-128 Authenticated Encryption, which takes 128 -bit secret key, 96
 // -bit public message nonce, N -bytes of associated data ( which is never
 // encrypted ) & M -bytes of plain text ( which is encrypted ), producing M
 // -bytes of cipher text & 64 -bit of authentication tag --- providing
 // confidentiality, integrity & authentication
-inline void
+//
+// Template parameter `fbk` chooses # -of feedback bits computed per iteration
+// of underlying permutation, which only affects performance, not output.
+//
+// Note, `text` & `cipher` may point to same memory, see `encrypt_inplace`.
+template<const fbk_t fbk = DEFAULT_FBK>
+inline constexpr void
 encrypt(const uint8_t* const __restrict key,   // 128 -bit secret key
         const uint8_t* const __restrict nonce, // 96 -bit public message nonce
         const uint8_t* const __restrict data,  // associated data
         const size_t data_len,                 // associated data byte length
-        const uint8_t* const __restrict text,  // plain text
-        uint8_t* const __restrict cipher,      // cipher text
+        const uint8_t* const text,             // plain text
+        uint8_t* const cipher,                 // cipher text
         const size_t ct_len,                   // plain/ cipher text byte length
         uint8_t* const __restrict tag          // 64 -bit authentication tag
 )
@@ -26,36 +63,12 @@ encrypt(const uint8_t* const __restrict key,   // 128 -bit secret key
   uint32_t state[4]{};
   uint32_t key_[4];
 
-#if defined __x86_64__ && !defined __clang__ && defined __GNUG__ &&            \
-  __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
-
-  std::memcpy(key_, key, 16);
+  load_key<variant::key_128>(key, key_);
 
-#else
-
-#if defined __clang__
-  // Following
-  // https://clang.llvm.org/docs/LanguageExtensions.html#extensions-for-loop-hint-optimizations
-
-#pragma clang loop unroll(enable)
-#pragma clang loop vectorize(enable)
-#elif defined __GNUG__
-  // Following
-  // https://gcc.gnu.org/onlinedocs/gcc/Loop-Specific-Pragmas.html#Loop-Specific-Pragmas
-
-#pragma GCC ivdep
-#pragma GCC unroll 4
-#endif
-  for (size_t i = 0; i < 4; i++) {
-    key_[i] = from_le_bytes(key + (i << 2));
-  }
-
-#endif
-
-  initialize<variant::key_128>(state, key_, nonce);
-  process_associated_data<variant::key_128>(state, key_, data, data_len);
-  process_plain_text<variant::key_128>(state, key_, text, cipher, ct_len);
-  finalize<variant::key_128>(state, key_, tag);
+  initialize<variant::key_128, fbk>(state, key_, nonce);
+  process_associated_data<variant::key_128, fbk>(state, key_, data, data_len);
+  process_plain_text<variant::key_128, fbk>(state, key_, text, cipher, ct_len);
+  finalize<variant::key_128, fbk>(state, key_, tag);
 }
 
 // TinyJambu-128 Verified Decryption, which takes 128 -bit secret key, 96
@@ -66,14 +79,20 @@ encrypt(const uint8_t* const __restrict key,   // 128 -bit secret key
 //
 // Note, if returned boolean verification status is not truth value, don't
 // consume decrypted bytes !
-inline bool
+//
+// Template parameter `fbk` chooses # -of feedback bits computed per iteration
+// of underlying permutation, which only affects performance, not output.
+//
+// Note, `cipher` & `text` may point to same memory, see `decrypt_inplace`.
+template<const fbk_t fbk = DEFAULT_FBK>
+inline constexpr bool
 decrypt(const uint8_t* const __restrict key,    // 128 -bit secret key
         const uint8_t* const __restrict nonce,  // 96 -bit public message nonce
         const uint8_t* const __restrict tag,    // 64 -bit authentication tag
         const uint8_t* const __restrict data,   // associated data
         const size_t data_len,                  // associated data byte length
-        const uint8_t* const __restrict cipher, // cipher text
-        uint8_t* const __restrict text,         // plain text
+        const uint8_t* const cipher,            // cipher text
+        uint8_t* const text,                    // plain text
         const size_t ct_len // cipher/ plain text byte length
 )
 {
@@ -84,59 +103,477 @@ decrypt(const uint8_t* const __restrict key,    // 128 -bit secret key
   uint32_t key_[4];
   uint8_t tag_[8]{};
 
-#if defined __x86_64__ && !defined __clang__ && defined __GNUG__ &&            \
-  __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  load_key<variant::key_128>(key, key_);
 
-  std::memcpy(key_, key, 16);
+  initialize<variant::key_128, fbk>(state, key_, nonce);
+  process_associated_data<variant::key_128, fbk>(state, key_, data, data_len);
+  process_cipher_text<variant::key_128, fbk>(state, key_, cipher, text, ct_len);
+  finalize<variant::key_128, fbk>(state, key_, tag_);
 
-#else
+  const bool flag = mismatch(tag, tag_);
 
-#if defined __clang__
-  // Following
-  // https://clang.llvm.org/docs/LanguageExtensions.html#extensions-for-loop-hint-optimizations
+  // prevent release of unverified plain text ( RUP )
+  wipe(text, flag * ct_len);
+  return !flag;
+}
 
-#pragma clang loop unroll(enable)
-#pragma clang loop vectorize(enable)
-#elif defined __GNUG__
-  // Following
-  // https://gcc.gnu.org/onlinedocs/gcc/Loop-Specific-Pragmas.html#Loop-Specific-Pragmas
+// In-place TinyJambu-128 Authenticated Encryption, which overwrites M -bytes
+// plain text in `buf` with equal number of cipher text bytes, while computing
+// 64 -bit authentication tag, so that no separate output buffer is required.
+// Produces same cipher text & authentication tag as `encrypt`.
+template<const fbk_t fbk = DEFAULT_FBK>
+inline constexpr void
+encrypt_inplace(
+  const uint8_t* const __restrict key,   // 128 -bit secret key
+  const uint8_t* const __restrict nonce, // 96 -bit public message nonce
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // associated data byte length
+  uint8_t* const __restrict buf,         // plain text in, cipher text out
+  const size_t ct_len,                   // plain/ cipher text byte length
+  uint8_t* const __restrict tag          // 64 -bit authentication tag
+)
+{
+  encrypt<fbk>(key, nonce, data, data_len, buf, buf, ct_len, tag);
+}
 
-#pragma GCC ivdep
-#pragma GCC unroll 4
-#endif
-  for (size_t i = 0; i < 4; i++) {
-    key_[i] = from_le_bytes(key + (i << 2));
-  }
+// In-place TinyJambu-128 Verified Decryption, which overwrites M -bytes cipher
+// text in `buf` with equal number of plain text bytes, returning boolean
+// verification flag. Produces same plain text & verification flag as `decrypt`.
+//
+// Note, if returned boolean verification status is not truth value, `buf` is
+// zeroed, so don't consume it !
+template<const fbk_t fbk = DEFAULT_FBK>
+inline constexpr bool
+decrypt_inplace(
+  const uint8_t* const __restrict key,   // 128 -bit secret key
+  const uint8_t* const __restrict nonce, // 96 -bit public message nonce
+  const uint8_t* const __restrict tag,   // 64 -bit authentication tag
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // associated data byte length
+  uint8_t* const __restrict buf,         // cipher text in, plain text out
+  const size_t ct_len                    // cipher/ plain text byte length
+)
+{
+  return decrypt<fbk>(key, nonce, tag, data, data_len, buf, buf, ct_len);
+}
 
-#endif
+// Fixed-length TinyJambu-128 Authenticated Encryption, for `ad_len` -bytes
+// associated data & `ct_len` -bytes plain text, both known at compile-time, so
+// that all length arithmetic & partial word handling is resolved by compiler,
+// which emits straight-line code. Produces same cipher text & authentication
+// tag as `encrypt`, invoked with same lengths.
+template<const size_t ad_len,
+         const size_t ct_len,
+         const fbk_t fbk = DEFAULT_FBK>
+inline constexpr void
+encrypt(const uint8_t* const __restrict key,   // 128 -bit secret key
+        const uint8_t* const __restrict nonce, // 96 -bit public message nonce
+        const uint8_t* const __restrict data,  // associated data
+        const uint8_t* const text,             // plain text
+        uint8_t* const cipher,                 // cipher text
+        uint8_t* const __restrict tag          // 64 -bit authentication tag
+)
+{
+  using namespace tinyjambu;
 
-  initialize<variant::key_128>(state, key_, nonce);
-  process_associated_data<variant::key_128>(state, key_, data, data_len);
-  process_cipher_text<variant::key_128>(state, key_, cipher, text, ct_len);
-  finalize<variant::key_128>(state, key_, tag_);
+  constexpr variant v = variant::key_128;
+  encrypt_fixed<v, ad_len, ct_len, fbk>(key, nonce, data, text, cipher, tag);
+}
+
+// Fixed-length TinyJambu-128 Verified Decryption, for `ad_len` -bytes
+// associated data & `ct_len` -bytes cipher text, both known at compile-time.
+// Produces same plain text & verification flag as `decrypt`, invoked with same
+// lengths.
+//
+// Note, if returned boolean verification status is not truth value, plain text
+// is zeroed, so don't consume it !
+template<const size_t ad_len,
+         const size_t ct_len,
+         const fbk_t fbk = DEFAULT_FBK>
+inline constexpr bool
+decrypt(const uint8_t* const __restrict key,   // 128 -bit secret key
+        const uint8_t* const __restrict nonce, // 96 -bit public message nonce
+        const uint8_t* const __restrict tag,   // 64 -bit authentication tag
+        const uint8_t* const __restrict data,  // associated data
+        const uint8_t* const cipher,           // cipher text
+        uint8_t* const text                    // plain text
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_128;
+  return decrypt_fixed<v, ad_len, ct_len, fbk>(
+    key, nonce, tag, data, cipher, text);
+}
 
-  bool flag = false;
+// TinyJambu-128 Authenticated Encryption, under 128 -bit secret key, known at
+// compile-time, whose key setup is run by compiler, so that each message
+// starts directly at nonce setup. Produces same cipher text & authentication
+// tag as `encrypt`, invoked with same key.
+template<const tinyjambu::key_bytes_t<tinyjambu::variant::key_128> key,
+         const fbk_t fbk = fbk_t::fbk_all>
+inline constexpr void
+encrypt_with_static_key(
+  const uint8_t* const __restrict nonce, // 96 -bit public message nonce
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // associated data byte length
+  const uint8_t* const text,             // plain text
+  uint8_t* const cipher,                 // cipher text
+  const size_t ct_len,                   // plain/ cipher text byte length
+  uint8_t* const __restrict tag          // 64 -bit authentication tag
+)
+{
+  static_key_context<key, fbk>::encrypt(
+    nonce, data, data_len, text, cipher, ct_len, tag);
+}
 
-#if defined __clang__
-  // Following
-  // https://clang.llvm.org/docs/LanguageExtensions.html#extensions-for-loop-hint-optimizations
+// TinyJambu-128 Verified Decryption, under 128 -bit secret key, known at
+// compile-time. Produces same plain text & verification flag as `decrypt`,
+// invoked with same key.
+//
+// Note, if returned boolean verification status is not truth value, plain text
+// is zeroed, so don't consume it !
+template<const tinyjambu::key_bytes_t<tinyjambu::variant::key_128> key,
+         const fbk_t fbk = fbk_t::fbk_all>
+inline constexpr bool
+decrypt_with_static_key(
+  const uint8_t* const __restrict nonce, // 96 -bit public message nonce
+  const uint8_t* const __restrict tag,   // 64 -bit authentication tag
+  const uint8_t* const __restrict data,  // associated data
+  const size_t data_len,                 // associated data byte length
+  const uint8_t* const cipher,           // cipher text
+  uint8_t* const text,                   // plain text
+  const size_t ct_len                    // cipher/ plain text byte length
+)
+{
+  return static_key_context<key, fbk>::decrypt(
+    nonce, tag, data, data_len, cipher, text, ct_len);
+}
 
-#pragma clang loop unroll(enable)
-#pragma clang loop vectorize(enable)
-#elif defined __GNUG__
-  // Following
-  // https://gcc.gnu.org/onlinedocs/gcc/Loop-Specific-Pragmas.html#Loop-Specific-Pragmas
+// Verify-only TinyJambu-128 decryption, which checks whether M -bytes cipher
+// text, N -bytes associated data & 64 -bit authentication tag are authentic,
+// under given secret key & nonce, without computing ( or writing ) any plain
+// text, returning same boolean verification flag as `decrypt`. Useful for
+// integrity scans, which don't need decrypted bytes.
+template<const fbk_t fbk = DEFAULT_FBK>
+inline constexpr bool
+verify(const uint8_t* const __restrict key,    // 128 -bit secret key
+       const uint8_t* const __restrict nonce,  // 96 -bit public message nonce
+       const uint8_t* const __restrict tag,    // 64 -bit authentication tag
+       const uint8_t* const __restrict data,   // associated data
+       const size_t data_len,                  // associated data byte length
+       const uint8_t* const __restrict cipher, // cipher text
+       const size_t ct_len                     // cipher text byte length
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_128;
+
+  // note permutation state must be zero initialized !
+  uint32_t state[4]{};
+  uint32_t key_[key_word_cnt<v>()];
+  uint8_t tag_[8]{};
+
+  load_key<v>(key, key_);
+
+  initialize<v, fbk>(state, key_, nonce);
+  process_associated_data<v, fbk>(state, key_, data, data_len);
+  authenticate_cipher_text<v, fbk>(state, key_, cipher, ct_len);
+  finalize<v, fbk>(state, key_, tag_);
+
+  return !mismatch(tag, tag_);
+}
+
+// Sealing TinyJambu-128 Authenticated Encryption, which writes M -bytes cipher
+// text, followed by 64 -bit authentication tag, to ( M + 8 ) -bytes `sealed`
+// buffer, so that caller doesn't need to manage a separate tag buffer. Produces
+// same bytes as `encrypt`, when its cipher text & tag are concatenated.
+//
+// Note, `text` & `sealed` may point to same memory, for in-place sealing of M
+// -bytes plain text, held in a buffer of ( M + 8 ) -bytes.
+template<const fbk_t fbk = DEFAULT_FBK>
+inline constexpr void
+seal(const uint8_t* const __restrict key,   // 128 -bit secret key
+     const uint8_t* const __restrict nonce, // 96 -bit public message nonce
+     const uint8_t* const __restrict data,  // associated data
+     const size_t data_len,                 // associated data byte length
+     const uint8_t* const text,             // plain text
+     const size_t ct_len,                   // plain text byte length
+     uint8_t* const sealed                  // cipher text || tag
+)
+{
+  uint8_t* const tag = sealed + ct_len;
+
+  encrypt<fbk>(key, nonce, data, data_len, text, sealed, ct_len, tag);
+}
 
-#pragma GCC ivdep
-#pragma GCC unroll 8
-#endif
-  for (size_t i = 0; i < 8; i++) {
-    flag |= static_cast<bool>(tag[i] ^ tag_[i]);
+// Opening TinyJambu-128 Verified Decryption, which reads ( M + 8 ) -bytes
+// `sealed` buffer, holding M -bytes cipher text followed by 64 -bit
+// authentication tag ( see `seal` ), writing M -bytes plain text & returning
+// boolean verification flag. If `sealed` is shorter than authentication tag,
+// nothing is written & verification fails.
+//
+// Note, `sealed` & `text` may point to same memory, for in-place opening.
+//
+// Note, if returned boolean verification status is not truth value, M -bytes
+// of `text` are zeroed, so don't consume them !
+template<const fbk_t fbk = DEFAULT_FBK>
+inline constexpr bool
+open(const uint8_t* const __restrict key,   // 128 -bit secret key
+     const uint8_t* const __restrict nonce, // 96 -bit public message nonce
+     const uint8_t* const __restrict data,  // associated data
+     const size_t data_len,                 // associated data byte length
+     const uint8_t* const sealed,           // cipher text || tag
+     const size_t sealed_len,               // cipher text byte length + 8
+     uint8_t* const text                    // plain text
+)
+{
+  if (sealed_len < 8) {
+    return false;
   }
 
-  // prevent release of unverified plain text ( RUP )
-  std::memset(text, 0, flag * ct_len);
-  return !flag;
+  const size_t ct_len = sealed_len - 8;
+  const uint8_t* const tag = sealed + ct_len;
+
+  return decrypt<fbk>(key, nonce, tag, data, data_len, sealed, text, ct_len);
+}
+
+// Scatter/ gather TinyJambu-128 Authenticated Encryption, where associated
+// data & plain text are read from lists of non-contiguous segments, while
+// cipher text is written to another list of segments, able to hold as many
+// bytes as plain text. Produces same cipher text & authentication tag as
+// `encrypt`, invoked with concatenation of respective segments.
+//
+// Note, if cipher text segments are shorter than plain text segments, nothing
+// is written & returned boolean is false.
+template<const fbk_t fbk = DEFAULT_FBK>
+inline bool
+encrypt(const uint8_t* const __restrict key,    // 128 -bit secret key
+        const uint8_t* const __restrict nonce,  // 96 -bit public message nonce
+        const tinyjambu::segments_t data,       // associated data
+        const tinyjambu::segments_t text,       // plain text
+        const tinyjambu::mut_segments_t cipher, // cipher text
+        uint8_t* const __restrict tag           // 64 -bit authentication tag
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_128;
+  return encrypt_segments<v, fbk>(key, nonce, data, text, cipher, tag);
+}
+
+// Scatter/ gather TinyJambu-128 Verified Decryption, where associated data &
+// cipher text are read from lists of non-contiguous segments, while plain text
+// is written to another list of segments, able to hold as many bytes as cipher
+// text. Produces same plain text & verification flag as `decrypt`, invoked with
+// concatenation of respective segments.
+//
+// Note, if returned boolean verification status is not truth value, plain text
+// segments are zeroed, so don't consume them ! Plain text segments shorter
+// than cipher text segments are rejected, without writing anything.
+template<const fbk_t fbk = DEFAULT_FBK>
+inline bool
+decrypt(const uint8_t* const __restrict key,   // 128 -bit secret key
+        const uint8_t* const __restrict nonce, // 96 -bit public message nonce
+        const uint8_t* const __restrict tag,   // 64 -bit authentication tag
+        const tinyjambu::segments_t data,      // associated data
+        const tinyjambu::segments_t cipher,    // cipher text
+        const tinyjambu::mut_segments_t text   // plain text
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_128;
+  return decrypt_segments<v, fbk>(key, nonce, tag, data, cipher, text);
+}
+
+// Batched TinyJambu-128 Authenticated Encryption of `msg_cnt` -many independent
+// messages, each with its own 128 -bit secret key, 96 -bit nonce, associated
+// data & plain text, processing `tinyjambu::LANE_CNT` -many messages in
+// lockstep, using SIMD lanes. Produces same cipher text & authentication tag as
+// calling `encrypt` on each message.
+template<const fbk_t fbk = DEFAULT_FBK>
+inline void
+encrypt_batch(
+  const uint8_t* const* const __restrict key,   // secret keys
+  const uint8_t* const* const __restrict nonce, // message nonces
+  const uint8_t* const* const __restrict data,  // associated data
+  const size_t* const __restrict data_len,      // associated data lengths
+  const uint8_t* const* const __restrict text,  // plain texts
+  uint8_t* const* const __restrict cipher,      // cipher texts
+  const size_t* const __restrict ct_len,        // plain/ cipher text lengths
+  uint8_t* const* const __restrict tag,         // authentication tags
+  const size_t msg_cnt                          // # -of messages
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_128;
+  tinyjambu::encrypt_batch<v, fbk>(
+    key, nonce, data, data_len, text, cipher, ct_len, tag, msg_cnt);
+}
+
+// Batched TinyJambu-128 Verified Decryption of `msg_cnt` -many independent
+// messages, processing `tinyjambu::LANE_CNT` -many messages in lockstep, using
+// SIMD lanes. Produces same plain text & verification flag as calling
+// `decrypt` on each message.
+//
+// Note, if flag[i] is not truth value, don't consume text[i] !
+template<const fbk_t fbk = DEFAULT_FBK>
+inline void
+decrypt_batch(
+  const uint8_t* const* const __restrict key,    // secret keys
+  const uint8_t* const* const __restrict nonce,  // message nonces
+  const uint8_t* const* const __restrict tag,    // authentication tags
+  const uint8_t* const* const __restrict data,   // associated data
+  const size_t* const __restrict data_len,       // associated data lengths
+  const uint8_t* const* const __restrict cipher, // cipher texts
+  uint8_t* const* const __restrict text,         // plain texts
+  const size_t* const __restrict ct_len,         // cipher/ plain text lengths
+  bool* const __restrict flag,                   // verification flags
+  const size_t msg_cnt                           // # -of messages
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_128;
+  tinyjambu::decrypt_batch<v, fbk>(
+    key, nonce, tag, data, data_len, cipher, text, ct_len, flag, msg_cnt);
+}
+
+// Interleaved TinyJambu-128 Authenticated Encryption of `msg_cnt` -many
+// independent messages, advancing N ( = 2 or 4 ) messages in same loop body,
+// using general purpose registers instead of SIMD lanes, which hides latency of
+// feedback bit dependency chain on CPUs without useful SIMD support. Produces
+// same cipher text & authentication tag as calling `encrypt` on each message.
+template<const size_t N = 2, const fbk_t fbk = DEFAULT_FBK>
+inline void
+encrypt_interleaved(
+  const uint8_t* const* const __restrict key,   // secret keys
+  const uint8_t* const* const __restrict nonce, // message nonces
+  const uint8_t* const* const __restrict data,  // associated data
+  const size_t* const __restrict data_len,      // associated data lengths
+  const uint8_t* const* const __restrict text,  // plain texts
+  uint8_t* const* const __restrict cipher,      // cipher texts
+  const size_t* const __restrict ct_len,        // plain/ cipher text lengths
+  uint8_t* const* const __restrict tag,         // authentication tags
+  const size_t msg_cnt                          // # -of messages
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_128;
+  tinyjambu::encrypt_batch<v, fbk, words_t<N>>(
+    key, nonce, data, data_len, text, cipher, ct_len, tag, msg_cnt);
+}
+
+// Interleaved TinyJambu-128 Verified Decryption of `msg_cnt` -many independent
+// messages, advancing N ( = 2 or 4 ) messages in same loop body, using general
+// purpose registers. Produces same plain text & verification flag as calling
+// `decrypt` on each message.
+//
+// Note, if flag[i] is not truth value, don't consume text[i] !
+template<const size_t N = 2, const fbk_t fbk = DEFAULT_FBK>
+inline void
+decrypt_interleaved(
+  const uint8_t* const* const __restrict key,    // secret keys
+  const uint8_t* const* const __restrict nonce,  // message nonces
+  const uint8_t* const* const __restrict tag,    // authentication tags
+  const uint8_t* const* const __restrict data,   // associated data
+  const size_t* const __restrict data_len,       // associated data lengths
+  const uint8_t* const* const __restrict cipher, // cipher texts
+  uint8_t* const* const __restrict text,         // plain texts
+  const size_t* const __restrict ct_len,         // cipher/ plain text lengths
+  bool* const __restrict flag,                   // verification flags
+  const size_t msg_cnt                           // # -of messages
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_128;
+  tinyjambu::decrypt_batch<v, fbk, words_t<N>>(
+    key, nonce, tag, data, data_len, cipher, text, ct_len, flag, msg_cnt);
+}
+
+// Structure-of-arrays TinyJambu-128 Authenticated Encryption of `msg_cnt`
+// -many fixed-size records, all under same 128 -bit secret key, where i-th
+// record's nonce, associated data & plain text are found at nonce[i * 12],
+// data[i * data_stride] & text[i * ct_stride], while its cipher text & tag are
+// written to cipher[i * ct_stride] & tag[i * 8]. As all records are of same
+// length, `tinyjambu::LANE_CNT` -many of them are processed in lockstep,
+// without masking any lane, while key setup is run only once. Produces same
+// cipher text & authentication tag as calling `encrypt` on each record.
+template<const fbk_t fbk = DEFAULT_FBK>
+inline void
+encrypt_soa(const uint8_t* const __restrict key,   // 128 -bit secret key
+            const uint8_t* const __restrict nonce, // contiguous 96 -bit nonces
+            const uint8_t* const __restrict data,  // associated data
+            const size_t data_stride,              // associated data stride
+            const size_t data_len,                 // associated data length
+            const uint8_t* const text,             // plain texts
+            uint8_t* const cipher,                 // cipher texts
+            const size_t ct_stride,                // plain/ cipher text stride
+            const size_t ct_len,                   // plain/ cipher text length
+            uint8_t* const __restrict tag,         // contiguous 64 -bit tags
+            const size_t msg_cnt                   // # -of records
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_128;
+  tinyjambu::encrypt_soa<v, fbk>(key,
+                                 nonce,
+                                 data,
+                                 data_stride,
+                                 data_len,
+                                 text,
+                                 cipher,
+                                 ct_stride,
+                                 ct_len,
+                                 tag,
+                                 msg_cnt);
+}
+
+// Structure-of-arrays TinyJambu-128 Verified Decryption of `msg_cnt` -many
+// fixed-size records ( see `encrypt_soa` ), where i-th record's tag is read
+// from tag[i * 8], while its plain text is written to text[i * ct_stride] &
+// verification flag to flag[i]. Produces same plain text & verification flag
+// as calling `decrypt` on each record.
+//
+// Note, if flag[i] is not truth value, i-th plain text is zeroed, so don't
+// consume it !
+template<const fbk_t fbk = DEFAULT_FBK>
+inline void
+decrypt_soa(const uint8_t* const __restrict key,   // 128 -bit secret key
+            const uint8_t* const __restrict nonce, // contiguous 96 -bit nonces
+            const uint8_t* const __restrict tag,   // contiguous 64 -bit tags
+            const uint8_t* const __restrict data,  // associated data
+            const size_t data_stride,              // associated data stride
+            const size_t data_len,                 // associated data length
+            const uint8_t* const cipher,           // cipher texts
+            uint8_t* const text,                   // plain texts
+            const size_t ct_stride,                // cipher/ plain text stride
+            const size_t ct_len,                   // cipher/ plain text length
+            bool* const __restrict flag,           // verification flags
+            const size_t msg_cnt                   // # -of records
+)
+{
+  using namespace tinyjambu;
+
+  constexpr variant v = variant::key_128;
+  tinyjambu::decrypt_soa<v, fbk>(key,
+                                 nonce,
+                                 tag,
+                                 data,
+                                 data_stride,
+                                 data_len,
+                                 cipher,
+                                 text,
+                                 ct_stride,
+                                 ct_len,
+                                 flag,
+                                 msg_cnt);
 }
 
 }
@@ -0,0 +1,812 @@
+#pragma once
+#include "tinyjambu.hpp"
+#include <algorithm>
+#include <type_traits>
+
+// Lane-parallel TinyJambu-{128, 192, 256} AEAD, processing N -many independent
+// messages ( each with its own secret key, nonce, associated data & plain/
+// cipher text ) in lockstep, by keeping one permutation state per SIMD lane
+namespace tinyjambu {
+
+// # -of independent messages, processed together by batched routines, decided
+// based on available SIMD register width
+#if defined __AVX512F__
+constexpr size_t LANE_CNT = 16ul;
+#elif defined __AVX2__
+constexpr size_t LANE_CNT = 8ul;
+#else
+constexpr size_t LANE_CNT = 4ul;
+#endif
+
+// LANE_CNT -many 32 -bit words packed into a single SIMD register, where i-th
+// lane holds a word of i-th message's state/ key
+typedef uint32_t lanes_t __attribute__((vector_size(LANE_CNT * 4ul)));
+
+// N -many 32 -bit words kept in general purpose registers, where i-th word
+// holds a word of i-th message's state/ key. It can be used in place of
+// `lanes_t`, for interleaving N ( = 2 or 4 ) independent messages in same loop
+// body, without using any SIMD instruction. Because each 32 feedback bits of
+// `state_update` depend on previous ones, a single message is latency bound,
+// while interleaving lets out-of-order CPU core execute N independent
+// dependency chains in parallel, on its scalar execution ports.
+template<const size_t N>
+struct words_t
+{
+  uint32_t w[N];
+
+  constexpr uint32_t& operator[](const size_t i) { return w[i]; }
+  constexpr const uint32_t& operator[](const size_t i) const { return w[i]; }
+};
+
+// Generates word-wise binary operator `op` ( and compound assignment variant
+// of it ) for `words_t`, where right hand side is either `words_t` or a
+// scalar, which is applied on each word
+//
+// Note, these are forcefully inlined, so that all words stay in registers.
+#define WORDS_BINARY_OP(op)                                                    \
+  template<const size_t N, typename R>                                         \
+  static inline __attribute__((always_inline)) constexpr words_t<N>          \
+  operator op(const words_t<N> a, const R b)                                   \
+  {                                                                            \
+    words_t<N> r;                                                              \
+    for (size_t i = 0; i < N; i++) {                                           \
+      if constexpr (std::is_same_v<R, words_t<N>>) {                           \
+        r[i] = a[i] op b[i];                                                   \
+      } else {                                                                 \
+        r[i] = a[i] op static_cast<uint32_t>(b);                               \
+      }                                                                        \
+    }                                                                          \
+    return r;                                                                  \
+  }                                                                            \
+                                                                               \
+  template<const size_t N, typename R>                                         \
+  static inline __attribute__((always_inline)) constexpr words_t<N>&         \
+  operator op##=(words_t<N>& a, const R b)                                     \
+  {                                                                            \
+    a = a op b;                                                                \
+    return a;                                                                  \
+  }
+
+WORDS_BINARY_OP(^)
+WORDS_BINARY_OP(&)
+WORDS_BINARY_OP(|)
+WORDS_BINARY_OP(<<)
+WORDS_BINARY_OP(>>)
+
+#undef WORDS_BINARY_OP
+
+// Word-wise bitwise negation of `words_t`
+template<const size_t N>
+static inline __attribute__((always_inline)) constexpr words_t<N>
+operator~(const words_t<N> a)
+{
+  words_t<N> r;
+  for (size_t i = 0; i < N; i++) {
+    r[i] = ~a[i];
+  }
+  return r;
+}
+
+// Lane-wise selection, taking word from `a` when respective lane of `mask` has
+// all bits set, otherwise taking word from `b`
+template<typename T>
+static inline T
+blend(const T mask, const T a, const T b)
+{
+  return (a & mask) | (b & ~mask);
+}
+
+// Lane-parallel equivalent of `initialize`, where i-th lane's nonce is read
+// from nonce[i]
+template<const variant v, const fbk_t fbk, typename T>
+static inline void
+initialize_batch(T* const __restrict state,
+                 const T* const __restrict key,
+                 const uint8_t* const* const __restrict nonce)
+{
+  constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+
+  for (size_t i = 0; i < 4; i++) {
+    state[i] = T{};
+  }
+
+  // key setup
+  permute<v, key_rounds<v>(), fbk>(state, key);
+
+  // nonce setup
+  for (size_t i = 0; i < 3; i++) {
+    state[1] ^= FRAMEBITS_NONCE;
+    permute<v, 640ul, fbk>(state, key);
+
+    T word{};
+    for (size_t l = 0; l < N; l++) {
+      word[l] = from_le_bytes(nonce[l] + i * 4);
+    }
+    state[3] ^= word;
+  }
+}
+
+// Lane-parallel equivalent of `process_associated_data`, where lanes may have
+// different associated data length; a lane which has already consumed all its
+// bytes keeps its state untouched, while others continue
+template<const variant v, const fbk_t fbk, typename T>
+static inline void
+process_associated_data_batch(T* const __restrict state,
+                              const T* const __restrict key,
+                              const uint8_t* const* const __restrict data,
+                              const size_t* const __restrict data_len)
+{
+  constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+
+  T part_byte_cnt{};
+  for (size_t l = 0; l < N; l++) {
+    part_byte_cnt[l] = static_cast<uint32_t>(data_len[l] & 3ul);
+  }
+
+  const size_t max_len = *std::max_element(data_len, data_len + N);
+
+  for (size_t b_off = 0; b_off < max_len; b_off += 4) {
+    T active{};
+    T word{};
+
+    for (size_t l = 0; l < N; l++) {
+      if (b_off < data_len[l]) {
+        const size_t take = std::min(4ul, data_len[l] - b_off);
+
+        active[l] = 0xffffffffu;
+        word[l] = from_le_bytes(data[l] + b_off, take);
+      }
+    }
+
+    T tmp[4]{ state[0], state[1], state[2], state[3] };
+
+    tmp[1] ^= FRAMEBITS_AD;
+    permute<v, 640ul, fbk>(tmp, key);
+    tmp[3] ^= word;
+
+    for (size_t i = 0; i < 4; i++) {
+      state[i] = blend(active, tmp[i], state[i]);
+    }
+  }
+
+  state[1] ^= part_byte_cnt;
+}
+
+// Lane-parallel equivalent of `process_plain_text`, where lanes may have
+// different plain text length
+template<const variant v, const fbk_t fbk, typename T>
+static inline void
+process_plain_text_batch(T* const __restrict state,
+                         const T* const __restrict key,
+                         const uint8_t* const* const __restrict text,
+                         uint8_t* const* const __restrict cipher,
+                         const size_t* const __restrict ct_len)
+{
+  constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+
+  T part_byte_cnt{};
+  for (size_t l = 0; l < N; l++) {
+    part_byte_cnt[l] = static_cast<uint32_t>(ct_len[l] & 3ul);
+  }
+
+  const size_t max_len = *std::max_element(ct_len, ct_len + N);
+
+  for (size_t b_off = 0; b_off < max_len; b_off += 4) {
+    T active{};
+    T word{};
+
+    for (size_t l = 0; l < N; l++) {
+      if (b_off < ct_len[l]) {
+        const size_t take = std::min(4ul, ct_len[l] - b_off);
+
+        active[l] = 0xffffffffu;
+        word[l] = from_le_bytes(text[l] + b_off, take);
+      }
+    }
+
+    T tmp[4]{ state[0], state[1], state[2], state[3] };
+
+    tmp[1] ^= FRAMEBITS_CT;
+    permute<v, key_rounds<v>(), fbk>(tmp, key);
+    tmp[3] ^= word;
+
+    const T enc = tmp[2] ^ word;
+
+    for (size_t l = 0; l < N; l++) {
+      if (b_off < ct_len[l]) {
+        const size_t take = std::min(4ul, ct_len[l] - b_off);
+        to_le_bytes(enc[l], cipher[l] + b_off, take);
+      }
+    }
+
+    for (size_t i = 0; i < 4; i++) {
+      state[i] = blend(active, tmp[i], state[i]);
+    }
+  }
+
+  state[1] ^= part_byte_cnt;
+}
+
+// Lane-parallel equivalent of `process_cipher_text`, where lanes may have
+// different cipher text length
+template<const variant v, const fbk_t fbk, typename T>
+static inline void
+process_cipher_text_batch(T* const __restrict state,
+                          const T* const __restrict key,
+                          const uint8_t* const* const __restrict cipher,
+                          uint8_t* const* const __restrict text,
+                          const size_t* const __restrict ct_len)
+{
+  constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+
+  T part_byte_cnt{};
+  for (size_t l = 0; l < N; l++) {
+    part_byte_cnt[l] = static_cast<uint32_t>(ct_len[l] & 3ul);
+  }
+
+  const size_t max_len = *std::max_element(ct_len, ct_len + N);
+
+  for (size_t b_off = 0; b_off < max_len; b_off += 4) {
+    T active{};
+    T word{};
+    T mask{};
+
+    for (size_t l = 0; l < N; l++) {
+      if (b_off < ct_len[l]) {
+        const size_t take = std::min(4ul, ct_len[l] - b_off);
+
+        active[l] = 0xffffffffu;
+        word[l] = from_le_bytes(cipher[l] + b_off, take);
+        mask[l] = 0xffffffffu >> ((4ul - take) << 3);
+      }
+    }
+
+    T tmp[4]{ state[0], state[1], state[2], state[3] };
+
+    tmp[1] ^= FRAMEBITS_CT;
+    permute<v, key_rounds<v>(), fbk>(tmp, key);
+
+    const T dec = tmp[2] ^ word;
+    tmp[3] ^= (dec & mask);
+
+    for (size_t l = 0; l < N; l++) {
+      if (b_off < ct_len[l]) {
+        const size_t take = std::min(4ul, ct_len[l] - b_off);
+        to_le_bytes(dec[l], text[l] + b_off, take);
+      }
+    }
+
+    for (size_t i = 0; i < 4; i++) {
+      state[i] = blend(active, tmp[i], state[i]);
+    }
+  }
+
+  state[1] ^= part_byte_cnt;
+}
+
+// Lane-parallel equivalent of `finalize`, where i-th lane's 64 -bit
+// authentication tag is written to tag[i]
+template<const variant v, const fbk_t fbk, typename T>
+static inline void
+finalize_batch(T* const __restrict state,
+               const T* const __restrict key,
+               uint8_t* const* const __restrict tag)
+{
+  constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+
+  state[1] ^= FRAMEBITS_TAG;
+  permute<v, key_rounds<v>(), fbk>(state, key);
+
+  for (size_t l = 0; l < N; l++) {
+    to_le_bytes(state[2][l], tag[l]);
+  }
+
+  state[1] ^= FRAMEBITS_TAG;
+  permute<v, 640ul, fbk>(state, key);
+
+  for (size_t l = 0; l < N; l++) {
+    to_le_bytes(state[2][l], tag[l] + 4);
+  }
+}
+
+// Packs secret keys of N messages into lane-parallel key schedule, such that
+// i-th key word of l-th message lives in l-th lane of key_[i]. Each key word
+// is built in a local vector & assigned whole, so that `key_` need not be
+// initialized beforehand
+template<const variant v, typename T>
+static inline void
+load_keys(const uint8_t* const* const __restrict key, T* const __restrict key_)
+{
+  constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+
+  for (size_t i = 0; i < key_word_cnt<v>(); i++) {
+    T word{};
+    for (size_t l = 0; l < N; l++) {
+      word[l] = from_le_bytes(key[l] + (i << 2));
+    }
+    key_[i] = word;
+  }
+}
+
+// Authenticated encryption of `msg_cnt` -many independent messages, where
+// messages are taken N ( = # -of lanes in `T` ) at a time & processed in
+// lockstep. i-th message uses key[i], nonce[i], data[i] ( of length
+// data_len[i] ) & text[i] ( of length ct_len[i] ), producing cipher[i] &
+// tag[i].
+template<const variant v,
+         const fbk_t fbk = DEFAULT_FBK,
+         typename T = lanes_t>
+static inline void
+encrypt_batch(const uint8_t* const* const __restrict key,
+              const uint8_t* const* const __restrict nonce,
+              const uint8_t* const* const __restrict data,
+              const size_t* const __restrict data_len,
+              const uint8_t* const* const __restrict text,
+              uint8_t* const* const __restrict cipher,
+              const size_t* const __restrict ct_len,
+              uint8_t* const* const __restrict tag,
+              const size_t msg_cnt)
+{
+  constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+
+  // unused lanes ( if any ) of last batch work on empty messages, under all
+  // zero key & nonce, while their tags are written to scratch space
+  uint8_t zeros[32]{};
+  uint8_t scratch[N][8];
+
+  for (size_t off = 0; off < msg_cnt; off += N) {
+    const size_t cnt = std::min(N, msg_cnt - off);
+
+    const uint8_t* key_[N];
+    const uint8_t* nonce_[N];
+    const uint8_t* data_[N];
+    size_t data_len_[N];
+    const uint8_t* text_[N];
+    uint8_t* cipher_[N];
+    size_t ct_len_[N];
+    uint8_t* tag_[N];
+
+    for (size_t l = 0; l < N; l++) {
+      const bool used = l < cnt;
+
+      key_[l] = used ? key[off + l] : zeros;
+      nonce_[l] = used ? nonce[off + l] : zeros;
+      data_[l] = used ? data[off + l] : zeros;
+      data_len_[l] = used ? data_len[off + l] : 0ul;
+      text_[l] = used ? text[off + l] : zeros;
+      cipher_[l] = used ? cipher[off + l] : nullptr;
+      ct_len_[l] = used ? ct_len[off + l] : 0ul;
+      tag_[l] = used ? tag[off + l] : scratch[l];
+    }
+
+    T state[4];
+    T keys[key_word_cnt<v>()];
+
+    load_keys<v>(key_, keys);
+
+    initialize_batch<v, fbk>(state, keys, nonce_);
+    process_associated_data_batch<v, fbk>(state, keys, data_, data_len_);
+    process_plain_text_batch<v, fbk>(state, keys, text_, cipher_, ct_len_);
+    finalize_batch<v, fbk>(state, keys, tag_);
+  }
+}
+
+// Verified decryption of `msg_cnt` -many independent messages, where messages
+// are taken N ( = # -of lanes in `T` ) at a time & processed in lockstep. i-th
+// message uses key[i], nonce[i], tag[i], data[i] ( of length data_len[i] ) &
+// cipher[i] ( of length ct_len[i] ), producing text[i] & boolean verification
+// flag[i].
+//
+// Note, if flag[i] is not truth value, text[i] is zeroed, so don't consume it !
+template<const variant v,
+         const fbk_t fbk = DEFAULT_FBK,
+         typename T = lanes_t>
+static inline void
+decrypt_batch(const uint8_t* const* const __restrict key,
+              const uint8_t* const* const __restrict nonce,
+              const uint8_t* const* const __restrict tag,
+              const uint8_t* const* const __restrict data,
+              const size_t* const __restrict data_len,
+              const uint8_t* const* const __restrict cipher,
+              uint8_t* const* const __restrict text,
+              const size_t* const __restrict ct_len,
+              bool* const __restrict flag,
+              const size_t msg_cnt)
+{
+  constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+
+  uint8_t zeros[32]{};
+  uint8_t tags[N][8];
+
+  for (size_t off = 0; off < msg_cnt; off += N) {
+    const size_t cnt = std::min(N, msg_cnt - off);
+
+    const uint8_t* key_[N];
+    const uint8_t* nonce_[N];
+    const uint8_t* data_[N];
+    size_t data_len_[N];
+    const uint8_t* cipher_[N];
+    uint8_t* text_[N];
+    size_t ct_len_[N];
+    uint8_t* tag_[N];
+
+    for (size_t l = 0; l < N; l++) {
+      const bool used = l < cnt;
+
+      key_[l] = used ? key[off + l] : zeros;
+      nonce_[l] = used ? nonce[off + l] : zeros;
+      data_[l] = used ? data[off + l] : zeros;
+      data_len_[l] = used ? data_len[off + l] : 0ul;
+      cipher_[l] = used ? cipher[off + l] : zeros;
+      text_[l] = used ? text[off + l] : nullptr;
+      ct_len_[l] = used ? ct_len[off + l] : 0ul;
+      tag_[l] = tags[l];
+    }
+
+    T state[4];
+    T keys[key_word_cnt<v>()];
+
+    load_keys<v>(key_, keys);
+
+    initialize_batch<v, fbk>(state, keys, nonce_);
+    process_associated_data_batch<v, fbk>(state, keys, data_, data_len_);
+    process_cipher_text_batch<v, fbk>(state, keys, cipher_, text_, ct_len_);
+    finalize_batch<v, fbk>(state, keys, tag_);
+
+    for (size_t l = 0; l < cnt; l++) {
+      const bool fail = mismatch(tag[off + l], tags[l]);
+
+      // prevent release of unverified plain text ( RUP )
+      std::memset(text[off + l], 0, fail * ct_len[off + l]);
+      flag[off + l] = !fail;
+    }
+  }
+}
+
+// Structure-of-arrays equivalent of `initialize`, where i-th lane's nonce is
+// read from nonce[i * 12 .. (i + 1) * 12], while state after key setup (
+// `keyed`, same for all lanes ) is broadcast, instead of recomputing it
+template<const variant v, const fbk_t fbk, typename T>
+static inline void
+initialize_soa(T* const __restrict state,
+               const T* const __restrict key,
+               const uint32_t* const __restrict keyed,
+               const uint8_t* const __restrict nonce)
+{
+  constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+
+  for (size_t i = 0; i < 4; i++) {
+    state[i] = T{} ^ keyed[i];
+  }
+
+  for (size_t i = 0; i < 3; i++) {
+    state[1] ^= FRAMEBITS_NONCE;
+    permute<v, 640ul, fbk>(state, key);
+
+    T word{};
+    for (size_t l = 0; l < N; l++) {
+      word[l] = from_le_bytes(nonce + l * 12 + i * 4);
+    }
+    state[3] ^= word;
+  }
+}
+
+// Structure-of-arrays equivalent of `process_associated_data`, where i-th
+// lane's associated data starts at data[i * stride], while all of them are
+// `len` -bytes, so lanes never diverge
+template<const variant v, const fbk_t fbk, typename T>
+static inline void
+process_associated_data_soa(T* const __restrict state,
+                            const T* const __restrict key,
+                            const uint8_t* const __restrict data,
+                            const size_t stride,
+                            const size_t len)
+{
+  constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+
+  const size_t full = len & ~3ul;
+  const size_t part = len & 3ul;
+
+  for (size_t b_off = 0; b_off < full; b_off += 4) {
+    T word{};
+    for (size_t l = 0; l < N; l++) {
+      word[l] = from_le_bytes(data + l * stride + b_off);
+    }
+
+    state[1] ^= FRAMEBITS_AD;
+    permute<v, 640ul, fbk>(state, key);
+    state[3] ^= word;
+  }
+
+  if (part > 0) {
+    T word{};
+    for (size_t l = 0; l < N; l++) {
+      word[l] = from_le_bytes(data + l * stride + full, part);
+    }
+
+    state[1] ^= FRAMEBITS_AD;
+    permute<v, 640ul, fbk>(state, key);
+    state[3] ^= word;
+  }
+
+  state[1] ^= static_cast<uint32_t>(part);
+}
+
+// Structure-of-arrays equivalent of `process_plain_text`, where i-th lane's
+// plain/ cipher text starts at text/ cipher[i * stride], while all of them are
+// `len` -bytes, so lanes never diverge
+template<const variant v, const fbk_t fbk, typename T>
+static inline void
+process_plain_text_soa(T* const __restrict state,
+                       const T* const __restrict key,
+                       const uint8_t* const text,
+                       uint8_t* const cipher,
+                       const size_t stride,
+                       const size_t len)
+{
+  constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+
+  const size_t full = len & ~3ul;
+  const size_t part = len & 3ul;
+
+  for (size_t b_off = 0; b_off < full; b_off += 4) {
+    T word{};
+    for (size_t l = 0; l < N; l++) {
+      word[l] = from_le_bytes(text + l * stride + b_off);
+    }
+
+    state[1] ^= FRAMEBITS_CT;
+    permute<v, key_rounds<v>(), fbk>(state, key);
+    state[3] ^= word;
+
+    const T enc = state[2] ^ word;
+    for (size_t l = 0; l < N; l++) {
+      to_le_bytes(enc[l], cipher + l * stride + b_off);
+    }
+  }
+
+  if (part > 0) {
+    T word{};
+    for (size_t l = 0; l < N; l++) {
+      word[l] = from_le_bytes(text + l * stride + full, part);
+    }
+
+    state[1] ^= FRAMEBITS_CT;
+    permute<v, key_rounds<v>(), fbk>(state, key);
+    state[3] ^= word;
+
+    const T enc = state[2] ^ word;
+    for (size_t l = 0; l < N; l++) {
+      to_le_bytes(enc[l], cipher + l * stride + full, part);
+    }
+  }
+
+  state[1] ^= static_cast<uint32_t>(part);
+}
+
+// Structure-of-arrays equivalent of `process_cipher_text`, where i-th lane's
+// cipher/ plain text starts at cipher/ text[i * stride], while all of them are
+// `len` -bytes, so lanes never diverge
+template<const variant v, const fbk_t fbk, typename T>
+static inline void
+process_cipher_text_soa(T* const __restrict state,
+                        const T* const __restrict key,
+                        const uint8_t* const cipher,
+                        uint8_t* const text,
+                        const size_t stride,
+                        const size_t len)
+{
+  constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+
+  const size_t full = len & ~3ul;
+  const size_t part = len & 3ul;
+
+  for (size_t b_off = 0; b_off < full; b_off += 4) {
+    T word{};
+    for (size_t l = 0; l < N; l++) {
+      word[l] = from_le_bytes(cipher + l * stride + b_off);
+    }
+
+    state[1] ^= FRAMEBITS_CT;
+    permute<v, key_rounds<v>(), fbk>(state, key);
+
+    const T dec = state[2] ^ word;
+    state[3] ^= dec;
+
+    for (size_t l = 0; l < N; l++) {
+      to_le_bytes(dec[l], text + l * stride + b_off);
+    }
+  }
+
+  if (part > 0) {
+    T word{};
+    for (size_t l = 0; l < N; l++) {
+      word[l] = from_le_bytes(cipher + l * stride + full, part);
+    }
+
+    state[1] ^= FRAMEBITS_CT;
+    permute<v, key_rounds<v>(), fbk>(state, key);
+
+    const T dec = state[2] ^ word;
+    state[3] ^= dec & (0xffffffffu >> ((4ul - part) << 3));
+
+    for (size_t l = 0; l < N; l++) {
+      to_le_bytes(dec[l], text + l * stride + full, part);
+    }
+  }
+
+  state[1] ^= static_cast<uint32_t>(part);
+}
+
+// Authenticated encryption of `msg_cnt` -many fixed-size records, laid out as
+// structure-of-arrays, all under same secret key, where i-th record uses nonce
+// at nonce[i * 12], `data_len` -bytes associated data at data[i * data_stride]
+// & `ct_len` -bytes plain text at text[i * ct_stride], producing cipher text
+// at cipher[i * ct_stride] & tag at tag[i * 8]. Records are taken N ( = # -of
+// lanes in `T` ) at a time & processed in lockstep, where all lanes run same
+// # -of permutations, so no lane is ever masked. Key setup is run only once,
+// while remaining ( < N ) records are encrypted one after another.
+//
+// Note, `text` & `cipher` may point to same memory.
+template<const variant v,
+         const fbk_t fbk = DEFAULT_FBK,
+         typename T = lanes_t>
+static inline void
+encrypt_soa(const uint8_t* const __restrict key,
+            const uint8_t* const __restrict nonce,
+            const uint8_t* const __restrict data,
+            const size_t data_stride,
+            const size_t data_len,
+            const uint8_t* const text,
+            uint8_t* const cipher,
+            const size_t ct_stride,
+            const size_t ct_len,
+            uint8_t* const __restrict tag,
+            const size_t msg_cnt)
+{
+  constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+
+  uint32_t key_[key_word_cnt<v>()];
+  uint32_t keyed[4];
+
+  load_key<v>(key, key_);
+  setup_key<v, fbk>(keyed, key_);
+
+  T keys[key_word_cnt<v>()];
+  for (size_t i = 0; i < key_word_cnt<v>(); i++) {
+    keys[i] = T{} ^ key_[i];
+  }
+
+  const size_t lockstep = msg_cnt - msg_cnt % N;
+
+  for (size_t off = 0; off < lockstep; off += N) {
+    const uint8_t* const data_ = data + off * data_stride;
+    const uint8_t* const text_ = text + off * ct_stride;
+    uint8_t* const cipher_ = cipher + off * ct_stride;
+
+    uint8_t* tag_[N];
+    for (size_t l = 0; l < N; l++) {
+      tag_[l] = tag + (off + l) * 8;
+    }
+
+    T state[4];
+
+    initialize_soa<v, fbk>(state, keys, keyed, nonce + off * 12);
+    process_associated_data_soa<v, fbk>(
+      state, keys, data_, data_stride, data_len);
+    process_plain_text_soa<v, fbk>(
+      state, keys, text_, cipher_, ct_stride, ct_len);
+    finalize_batch<v, fbk>(state, keys, tag_);
+  }
+
+  for (size_t i = lockstep; i < msg_cnt; i++) {
+    uint32_t state[4]{ keyed[0], keyed[1], keyed[2], keyed[3] };
+
+    for (size_t j = 0; j < 3; j++) {
+      setup_nonce_word<v, fbk>(state, key_, nonce + i * 12 + j * 4);
+    }
+
+    const uint8_t* const data_ = data + i * data_stride;
+    const uint8_t* const text_ = text + i * ct_stride;
+    uint8_t* const cipher_ = cipher + i * ct_stride;
+
+    process_associated_data<v, fbk>(state, key_, data_, data_len);
+    process_plain_text<v, fbk>(state, key_, text_, cipher_, ct_len);
+    finalize<v, fbk>(state, key_, tag + i * 8);
+  }
+}
+
+// Verified decryption of `msg_cnt` -many fixed-size records, laid out as
+// structure-of-arrays ( see `encrypt_soa` ), where i-th record's tag is read
+// from tag[i * 8], while plain text is written to text[i * ct_stride] &
+// boolean verification flag to flag[i].
+//
+// Note, `cipher` & `text` may point to same memory.
+//
+// Note, if flag[i] is not truth value, i-th record's plain text is zeroed, so
+// don't consume it !
+template<const variant v,
+         const fbk_t fbk = DEFAULT_FBK,
+         typename T = lanes_t>
+static inline void
+decrypt_soa(const uint8_t* const __restrict key,
+            const uint8_t* const __restrict nonce,
+            const uint8_t* const __restrict tag,
+            const uint8_t* const __restrict data,
+            const size_t data_stride,
+            const size_t data_len,
+            const uint8_t* const cipher,
+            uint8_t* const text,
+            const size_t ct_stride,
+            const size_t ct_len,
+            bool* const __restrict flag,
+            const size_t msg_cnt)
+{
+  constexpr size_t N = sizeof(T) / sizeof(uint32_t);
+
+  uint32_t key_[key_word_cnt<v>()];
+  uint32_t keyed[4];
+
+  load_key<v>(key, key_);
+  setup_key<v, fbk>(keyed, key_);
+
+  T keys[key_word_cnt<v>()];
+  for (size_t i = 0; i < key_word_cnt<v>(); i++) {
+    keys[i] = T{} ^ key_[i];
+  }
+
+  const size_t lockstep = msg_cnt - msg_cnt % N;
+
+  uint8_t tags[N][8];
+  uint8_t* tag_[N];
+  for (size_t l = 0; l < N; l++) {
+    tag_[l] = tags[l];
+  }
+
+  for (size_t off = 0; off < lockstep; off += N) {
+    const uint8_t* const data_ = data + off * data_stride;
+    const uint8_t* const cipher_ = cipher + off * ct_stride;
+    uint8_t* const text_ = text + off * ct_stride;
+
+    T state[4];
+
+    initialize_soa<v, fbk>(state, keys, keyed, nonce + off * 12);
+    process_associated_data_soa<v, fbk>(
+      state, keys, data_, data_stride, data_len);
+    process_cipher_text_soa<v, fbk>(
+      state, keys, cipher_, text_, ct_stride, ct_len);
+    finalize_batch<v, fbk>(state, keys, tag_);
+
+    for (size_t l = 0; l < N; l++) {
+      const bool fail = mismatch(tag + (off + l) * 8, tags[l]);
+
+      // prevent release of unverified plain text ( RUP )
+      std::memset(text_ + l * ct_stride, 0, fail * ct_len);
+      flag[off + l] = !fail;
+    }
+  }
+
+  for (size_t i = lockstep; i < msg_cnt; i++) {
+    uint32_t state[4]{ keyed[0], keyed[1], keyed[2], keyed[3] };
+
+    for (size_t j = 0; j < 3; j++) {
+      setup_nonce_word<v, fbk>(state, key_, nonce + i * 12 + j * 4);
+    }
+
+    const uint8_t* const data_ = data + i * data_stride;
+    const uint8_t* const cipher_ = cipher + i * ct_stride;
+    uint8_t* const text_ = text + i * ct_stride;
+
+    process_associated_data<v, fbk>(state, key_, data_, data_len);
+    process_cipher_text<v, fbk>(state, key_, cipher_, text_, ct_len);
+    finalize<v, fbk>(state, key_, tags[0]);
+
+    const bool fail = mismatch(tag + i * 8, tags[0]);
+
+    // prevent release of unverified plain text ( RUP )
+    std::memset(text_, 0, fail * ct_len);
+    flag[i] = !fail;
+  }
+}
+
+}
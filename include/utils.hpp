@@ -5,40 +5,48 @@
 #include <iomanip>
 #include <random>
 #include <sstream>
+#include <type_traits>
+#include <utility>
 
 // Given four consecutive little endian bytes, this function interprets them as
 // 32 -bit unsigned integer
-inline uint32_t
+//
+// Note, all byte conversion routines below fall back to portable byte-wise
+// code during constant evaluation, where `std::memcpy` can't be used.
+inline constexpr uint32_t
 from_le_bytes(const uint8_t* const bytes)
 {
 #if defined __x86_64__ && !defined __clang__ && defined __GNUG__ &&            \
   __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
 
-  uint32_t res;
-  std::memcpy(&res, bytes, 4);
-  return res;
+  if (!std::is_constant_evaluated()) {
+    uint32_t res;
+    std::memcpy(&res, bytes, 4);
+    return res;
+  }
 
-#else
+#endif
 
   return (static_cast<uint32_t>(bytes[3]) << 24) |
          (static_cast<uint32_t>(bytes[2]) << 16) |
          (static_cast<uint32_t>(bytes[1]) << 8) |
          (static_cast<uint32_t>(bytes[0]) << 0);
-
-#endif
 }
 
 // Given a 32 -bit unsigned interger, this function interprets it as four
 // consecutive little endian bytes
-inline void
+inline constexpr void
 to_le_bytes(const uint32_t word, uint8_t* const bytes)
 {
 #if defined __x86_64__ && !defined __clang__ && defined __GNUG__ &&            \
   __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
 
-  std::memcpy(bytes, &word, 4);
+  if (!std::is_constant_evaluated()) {
+    std::memcpy(bytes, &word, 4);
+    return;
+  }
 
-#else
+#endif
 
 #if defined __clang__
   // Following
@@ -56,8 +64,64 @@ to_le_bytes(const uint32_t word, uint8_t* const bytes)
   for (size_t i = 0; i < 4; i++) {
     bytes[i] = static_cast<uint8_t>(word >> (i << 3));
   }
+}
+
+// Given [1, 4] consecutive little endian bytes, this function interprets them
+// as 32 -bit unsigned integer, while missing higher bytes are considered to be
+// zero. Meant to be used only for last partial word of some byte array.
+inline constexpr uint32_t
+from_le_bytes(const uint8_t* const bytes, const size_t len)
+{
+  uint32_t res = 0u;
+
+#if defined __x86_64__ && !defined __clang__ && defined __GNUG__ &&            \
+  __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+
+  if (!std::is_constant_evaluated()) {
+    std::memcpy(&res, bytes, len);
+    return res;
+  }
+
+#endif
+
+  for (size_t i = 0; i < len; i++) {
+    res |= static_cast<uint32_t>(bytes[i]) << (i << 3);
+  }
+
+  return res;
+}
+
+// Given a 32 -bit unsigned interger, this function writes its lowest [1, 4]
+// bytes, in little endian order. Meant to be used only for last partial word
+// of some byte array.
+inline constexpr void
+to_le_bytes(const uint32_t word, uint8_t* const bytes, const size_t len)
+{
+#if defined __x86_64__ && !defined __clang__ && defined __GNUG__ &&            \
+  __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+
+  if (!std::is_constant_evaluated()) {
+    std::memcpy(bytes, &word, len);
+    return;
+  }
 
 #endif
+
+  for (size_t i = 0; i < len; i++) {
+    bytes[i] = static_cast<uint8_t>(word >> (i << 3));
+  }
+}
+
+// Invokes `fn` N -many times, passing i ( in [0, N) ) as
+// `std::integral_constant`, so that loop is unrolled at compile-time & i can be
+// used as a constant expression inside `fn`
+template<const size_t N, typename F>
+inline constexpr void
+unroll(F&& fn)
+{
+  [&]<size_t... i>(std::index_sequence<i...>) {
+    (fn(std::integral_constant<size_t, i>{}), ...);
+  }(std::make_index_sequence<N>{});
 }
 
 // Generate N -many random bytes from available random device
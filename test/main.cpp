@@ -48,5 +48,230 @@ main()
 
   std::cout << "[test] passed TinyJambu-256 AEAD" << std::endl;
 
+  using tinyjambu::variant;
+
+  for (size_t i = 0; i <= 4 * tinyjambu::LANE_CNT + 1; i++) {
+    test_tinyjambu::batch<variant::key_128>(i, MAX_DT_LEN, MAX_CT_LEN);
+    test_tinyjambu::batch<variant::key_192>(i, MAX_DT_LEN, MAX_CT_LEN);
+    test_tinyjambu::batch<variant::key_256>(i, MAX_DT_LEN, MAX_CT_LEN);
+  }
+
+  std::cout << "[test] passed batched TinyJambu-{128, 192, 256} AEAD"
+            << std::endl;
+
+  for (size_t i = 0; i <= 9; i++) {
+    test_tinyjambu::batch<variant::key_128, 2>(i, MAX_DT_LEN, MAX_CT_LEN);
+    test_tinyjambu::batch<variant::key_192, 2>(i, MAX_DT_LEN, MAX_CT_LEN);
+    test_tinyjambu::batch<variant::key_256, 2>(i, MAX_DT_LEN, MAX_CT_LEN);
+
+    test_tinyjambu::batch<variant::key_128, 4>(i, MAX_DT_LEN, MAX_CT_LEN);
+    test_tinyjambu::batch<variant::key_192, 4>(i, MAX_DT_LEN, MAX_CT_LEN);
+    test_tinyjambu::batch<variant::key_256, 4>(i, MAX_DT_LEN, MAX_CT_LEN);
+  }
+
+  std::cout << "[test] passed interleaved TinyJambu-{128, 192, 256} AEAD"
+            << std::endl;
+
+  for (size_t i = 0; i < 40; i += 3) {
+    for (size_t j = 0; j < 40; j += 13) {
+      for (size_t k = 0; k < 132; k += 11) {
+        test_tinyjambu::soa<variant::key_128>(i, j, k);
+        test_tinyjambu::soa<variant::key_192>(i, j, k);
+        test_tinyjambu::soa<variant::key_256>(i, j, k);
+      }
+    }
+  }
+
+  std::cout << "[test] passed structure-of-arrays TinyJambu-{128, 192, 256} "
+               "AEAD"
+            << std::endl;
+
+  for (size_t i = MIN_CT_LEN; i < MAX_CT_LEN; i++) {
+    for (size_t j = MIN_DT_LEN; j < MAX_DT_LEN; j++) {
+      test_tinyjambu::key_context<variant::key_128>(4, j, i);
+      test_tinyjambu::key_context<variant::key_192>(4, j, i);
+      test_tinyjambu::key_context<variant::key_256>(4, j, i);
+
+      test_tinyjambu::nonce_prefix_context<variant::key_128>(4, j, i);
+      test_tinyjambu::nonce_prefix_context<variant::key_192>(4, j, i);
+      test_tinyjambu::nonce_prefix_context<variant::key_256>(4, j, i);
+    }
+  }
+
+  std::cout << "[test] passed TinyJambu-{128, 192, 256} key/ nonce prefix "
+               "context"
+            << std::endl;
+
+  for (size_t i = MIN_CT_LEN; i < MAX_CT_LEN; i++) {
+    for (size_t j = MIN_DT_LEN; j < MAX_DT_LEN; j++) {
+      test_tinyjambu::feedback_widths<variant::key_128>(j, i);
+      test_tinyjambu::feedback_widths<variant::key_192>(j, i);
+      test_tinyjambu::feedback_widths<variant::key_256>(j, i);
+    }
+  }
+
+  std::cout << "[test] passed TinyJambu-{128, 192, 256} with 32/ 64/ 128/ all/ "
+               "u64 -bit feedback"
+            << std::endl;
+
+  for (size_t i = MIN_CT_LEN; i < MAX_CT_LEN; i++) {
+    for (size_t j = MIN_DT_LEN; j < MAX_DT_LEN; j++) {
+      test_tinyjambu::inplace<variant::key_128>(j, i);
+      test_tinyjambu::inplace<variant::key_192>(j, i);
+      test_tinyjambu::inplace<variant::key_256>(j, i);
+    }
+  }
+
+  std::cout << "[test] passed in-place TinyJambu-{128, 192, 256} AEAD"
+            << std::endl;
+
+  for (size_t i = MIN_CT_LEN; i < MAX_CT_LEN; i++) {
+    for (size_t j = MIN_DT_LEN; j < MAX_DT_LEN; j++) {
+      test_tinyjambu::scatter_gather<variant::key_128>(j, i);
+      test_tinyjambu::scatter_gather<variant::key_192>(j, i);
+      test_tinyjambu::scatter_gather<variant::key_256>(j, i);
+    }
+  }
+
+  std::cout << "[test] passed scatter/ gather TinyJambu-{128, 192, 256} AEAD"
+            << std::endl;
+
+  for (size_t i = MIN_CT_LEN; i < MAX_CT_LEN; i++) {
+    for (size_t j = MIN_DT_LEN; j < MAX_DT_LEN; j++) {
+      test_tinyjambu::stream<variant::key_128>(j, i);
+      test_tinyjambu::stream<variant::key_192>(j, i);
+      test_tinyjambu::stream<variant::key_256>(j, i);
+    }
+  }
+
+  std::cout << "[test] passed incremental TinyJambu-{128, 192, 256} AEAD"
+            << std::endl;
+
+  for (size_t i = MIN_CT_LEN; i < MAX_CT_LEN; i++) {
+    for (size_t j = MIN_DT_LEN; j < MAX_DT_LEN; j++) {
+      test_tinyjambu::verify<variant::key_128>(j, i);
+      test_tinyjambu::verify<variant::key_192>(j, i);
+      test_tinyjambu::verify<variant::key_256>(j, i);
+    }
+  }
+
+  std::cout << "[test] passed verify-only TinyJambu-{128, 192, 256} decryption"
+            << std::endl;
+
+  for (size_t i = MIN_CT_LEN; i < MAX_CT_LEN; i++) {
+    for (size_t j = MIN_DT_LEN; j < MAX_DT_LEN; j++) {
+      test_tinyjambu::seal<variant::key_128>(j, i);
+      test_tinyjambu::seal<variant::key_192>(j, i);
+      test_tinyjambu::seal<variant::key_256>(j, i);
+    }
+  }
+
+  std::cout << "[test] passed sealed TinyJambu-{128, 192, 256} AEAD"
+            << std::endl;
+
+  for (size_t n : { 1ul, 2ul, 4ul, 7ul }) {
+    tinyjambu::parallel::pool pool{ n };
+
+    for (size_t i = 0; i < 200; i += 13) {
+      test_tinyjambu::parallel<variant::key_128>(pool, i);
+      test_tinyjambu::parallel<variant::key_192>(pool, i);
+      test_tinyjambu::parallel<variant::key_256>(pool, i);
+    }
+  }
+
+  std::cout << "[test] passed multi-threaded TinyJambu-{128, 192, 256} AEAD"
+            << std::endl;
+
+  {
+    tinyjambu::parallel::pool pool{ 3 };
+
+    for (size_t c : { 1ul, 4ul, 7ul, 64ul }) {
+      for (size_t i = 0; i < 300; i += 11) {
+        test_tinyjambu::chunked<variant::key_128>(pool, 5, i, c);
+        test_tinyjambu::chunked<variant::key_192>(pool, 5, i, c);
+        test_tinyjambu::chunked<variant::key_256>(pool, 5, i, c);
+      }
+    }
+  }
+
+  std::cout << "[test] passed chunked TinyJambu-{128, 192, 256} AEAD"
+            << std::endl;
+
+  for (uint32_t c : { 1u, 5u, 64u }) {
+    for (size_t i = 0; i < 300; i += 23) {
+      test_tinyjambu::seekable<variant::key_128>(i, c);
+      test_tinyjambu::seekable<variant::key_192>(i, c);
+      test_tinyjambu::seekable<variant::key_256>(i, c);
+    }
+  }
+
+  std::cout << "[test] passed seekable TinyJambu-{128, 192, 256} container"
+            << std::endl;
+
+  for (size_t s : { 1ul, 7ul, 64ul }) {
+    for (size_t j = 0; j < 48; j += 23) {
+      for (size_t i = 0; i < 200; i += 17) {
+        test_tinyjambu::async<variant::key_128>(j, i, s);
+        test_tinyjambu::async<variant::key_192>(j, i, s);
+        test_tinyjambu::async<variant::key_256>(j, i, s);
+      }
+    }
+  }
+
+  std::cout << "[test] passed coroutine based TinyJambu-{128, 192, 256} AEAD"
+            << std::endl;
+
+  for (size_t i = 1; i < 200; i += 37) {
+    test_tinyjambu::multi_buffer<variant::key_128>(i, 40, 640);
+    test_tinyjambu::multi_buffer<variant::key_192>(i, 40, 640);
+    test_tinyjambu::multi_buffer<variant::key_256>(i, 40, 640);
+  }
+
+  std::cout << "[test] passed multi-buffer TinyJambu-{128, 192, 256} AEAD"
+            << std::endl;
+
+  for (size_t n : { 1ul, 3ul }) {
+    for (size_t i = 0; i < 300; i += 47) {
+      test_tinyjambu::pipeline<variant::key_128>(n, i);
+      test_tinyjambu::pipeline<variant::key_192>(n, i);
+      test_tinyjambu::pipeline<variant::key_256>(n, i);
+
+      test_tinyjambu::pipeline_mpmc<variant::key_128>(n, i);
+      test_tinyjambu::pipeline_mpmc<variant::key_192>(n, i);
+      test_tinyjambu::pipeline_mpmc<variant::key_256>(n, i);
+    }
+  }
+
+  std::cout << "[test] passed pipelined TinyJambu-{128, 192, 256} AEAD"
+            << std::endl;
+
+  test_tinyjambu::fixed_all<variant::key_128>();
+  test_tinyjambu::fixed_all<variant::key_192>();
+  test_tinyjambu::fixed_all<variant::key_256>();
+
+  std::cout << "[test] passed fixed-length TinyJambu-{128, 192, 256} AEAD"
+            << std::endl;
+
+  test_tinyjambu::compile_time_all<variant::key_128>();
+  test_tinyjambu::compile_time_all<variant::key_192>();
+  test_tinyjambu::compile_time_all<variant::key_256>();
+
+  std::cout << "[test] passed compile-time TinyJambu-{128, 192, 256} AEAD"
+            << std::endl;
+
+  for (size_t i = 0; i < 40; i += 3) {
+    for (size_t j = 0; j < 20; j += 3) {
+      test_tinyjambu::static_key<variant::key_128, fbk_t::fbk_all>(j, i);
+      test_tinyjambu::static_key<variant::key_192, fbk_t::fbk_all>(j, i);
+      test_tinyjambu::static_key<variant::key_256, fbk_t::fbk_all>(j, i);
+      test_tinyjambu::static_key<variant::key_128, DEFAULT_FBK>(j, i);
+      test_tinyjambu::static_key<variant::key_192, DEFAULT_FBK>(j, i);
+      test_tinyjambu::static_key<variant::key_256, DEFAULT_FBK>(j, i);
+    }
+  }
+
+  std::cout << "[test] passed compile-time key TinyJambu-{128, 192, 256} AEAD"
+            << std::endl;
+
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,559 @@
+#include "chunked.hpp"
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <random>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Command-line file encryptor, using chunked TinyJambu-{128, 192, 256} AEAD (
+// see chunked.hpp ), spreading chunks over a pool of worker threads.
+//
+// Usage
+//
+// tjcrypt (-e | -d) -k keyfile [-c chunk_len] [-t threads] [-i in] [-o out]
+//
+// where variant is picked based on byte length of key file ( = 16/ 24/ 32 ),
+// while input/ output default to stdin/ stdout. Chunk length ( defaulting to
+// 64 KiB ) is only used when encrypting, it's read back from header, when
+// decrypting, where it must not exceed 64 MiB. Worker count defaults to #
+// -of hardware threads. When both input & output are regular files, they're
+// memory mapped & whole file is encrypted/ decrypted in one go, otherwise (
+// say when reading from a pipe ) they're streamed, using large buffers,
+// carrying ~64 chunks per worker thread, but not more than 128 MiB.
+//
+// Encrypted file = header ( 32 -bytes ) || chunked encrypted object
+//
+// where header is laid out as
+//
+// | bytes  | field                                              |
+// | ------ | -------------------------------------------------- |
+// | 0..4   | magic "TJCR"                                       |
+// | 4      | format version ( = 1 )                             |
+// | 5      | variant ( = 0/ 1/ 2, for TinyJambu-128/ 192/ 256 ) |
+// | 6..8   | reserved, zero                                     |
+// | 8..12  | plain text bytes per chunk, little endian          |
+// | 12..19 | nonce prefix of chunked encryption                 |
+// | 19..32 | reserved, zero                                     |
+//
+// Whole header is used as associated data of every chunk. Header doesn't carry
+// plain text length, so that streamed input of unknown length can be encrypted.
+// Nonce prefix is freshly sampled for each encrypted file.
+//
+// Note, while decrypting streamed input, plain text is written chunk by chunk,
+// only after it's verified, but truncation of encrypted file is only detected
+// at its end. So output must not be consumed, unless exit status is zero !
+//
+// Compile with
+//
+// make tjcrypt
+namespace {
+
+using namespace tinyjambu;
+
+// Byte length of encrypted file header
+constexpr size_t HEADER_LEN = 32;
+
+// Format version, written to header
+constexpr uint8_t VERSION = 1;
+
+// Magic bytes, identifying an encrypted file
+constexpr uint8_t MAGIC[4]{ 'T', 'J', 'C', 'R' };
+
+// Default plain text bytes per chunk
+constexpr size_t CHUNK_LEN = 1ul << 16;
+
+// Largest plain text bytes per chunk, accepted both from command-line & from
+// header of an encrypted file, which is read before anything is verified
+constexpr size_t MAX_CHUNK_LEN = 1ul << 26;
+
+// Streaming buffers carry these many chunks, per worker thread
+constexpr size_t CHUNKS_PER_THREAD = 64;
+
+// Byte length budget of each streaming buffer, which takes precedence over
+// `CHUNKS_PER_THREAD`, though buffers always carry at least two chunks
+constexpr size_t STREAM_BUF_LEN = 1ul << 27;
+
+// Command-line options
+struct options_t
+{
+  bool enc = true;
+  const char* key_path = nullptr;
+  const char* in_path = nullptr;
+  const char* out_path = nullptr;
+  size_t chunk_len = CHUNK_LEN;
+  size_t threads = std::max(1u, std::thread::hardware_concurrency());
+};
+
+// Outcome of encryption/ decryption, reported on success
+struct report_t
+{
+  uint64_t bytes = 0; // plain text bytes processed
+  bool mapped = false;
+};
+
+// Reads upto `len` -bytes, stopping only at end of file, returning # -of bytes
+// read or -1 on error
+ssize_t
+read_full(const int fd, uint8_t* const buf, const size_t len)
+{
+  size_t done = 0;
+
+  while (done < len) {
+    const ssize_t n = ::read(fd, buf + done, len - done);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n < 0) {
+      return -1;
+    }
+    if (n == 0) {
+      break;
+    }
+    done += static_cast<size_t>(n);
+  }
+  return static_cast<ssize_t>(done);
+}
+
+// Writes all `len` -bytes, returning false on error
+bool
+write_full(const int fd, const uint8_t* const buf, const size_t len)
+{
+  size_t done = 0;
+
+  while (done < len) {
+    const ssize_t n = ::write(fd, buf + done, len - done);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n < 0) {
+      return false;
+    }
+    done += static_cast<size_t>(n);
+  }
+  return true;
+}
+
+// Serializes header into 32 -bytes
+void
+write_header(const variant v,
+             const uint32_t chunk_len,
+             const uint8_t* const __restrict prefix,
+             uint8_t* const __restrict out)
+{
+  std::memset(out, 0, HEADER_LEN);
+  std::memcpy(out, MAGIC, sizeof(MAGIC));
+
+  out[4] = VERSION;
+  out[5] = static_cast<uint8_t>(v);
+
+  for (size_t i = 0; i < 4; i++) {
+    out[8 + i] = static_cast<uint8_t>(chunk_len >> (i << 3));
+  }
+
+  std::memcpy(out + 12, prefix, chunked::PREFIX_LEN);
+}
+
+// Parses 32 -bytes header, returning false if it's not a well-formed header of
+// an encrypted file, produced using variant `v`
+bool
+read_header(const uint8_t* const __restrict in,
+            const variant v,
+            uint32_t& chunk_len,
+            uint8_t* const __restrict prefix)
+{
+  if (std::memcmp(in, MAGIC, sizeof(MAGIC)) != 0 || in[4] != VERSION) {
+    return false;
+  }
+  if (in[5] != static_cast<uint8_t>(v)) {
+    return false;
+  }
+
+  uint8_t acc = in[6] | in[7];
+  for (size_t i = 19; i < HEADER_LEN; i++) {
+    acc |= in[i];
+  }
+  if (acc != 0) {
+    return false;
+  }
+
+  chunk_len = 0;
+  for (size_t i = 0; i < 4; i++) {
+    chunk_len |= static_cast<uint32_t>(in[8 + i]) << (i << 3);
+  }
+
+  std::memcpy(prefix, in + 12, chunked::PREFIX_LEN);
+
+  return chunk_len > 0 && chunk_len <= MAX_CHUNK_LEN;
+}
+
+// Encrypts/ decrypts memory mapped input file into memory mapped output file,
+// both of which must be regular files. Returns false, with `errno` set, if
+// files can't be mapped ( so that caller can fall back to streaming ), while
+// `ok` is set to false, if file can't be decrypted.
+template<const variant v>
+bool
+run_mapped(const options_t& opt,
+           const uint8_t* const key,
+           const int in,
+           const int out,
+           parallel::pool& pool,
+           bool& ok,
+           report_t& rep)
+{
+  struct stat st;
+  if (::fstat(in, &st) != 0) {
+    return false;
+  }
+
+  const size_t len = static_cast<size_t>(st.st_size);
+
+  uint8_t* src = nullptr;
+  if (len > 0) {
+    void* p = ::mmap(nullptr, len, PROT_READ, MAP_PRIVATE, in, 0);
+    if (p == MAP_FAILED) {
+      return false;
+    }
+    src = static_cast<uint8_t*>(p);
+    ::madvise(p, len, MADV_SEQUENTIAL);
+  }
+
+  uint8_t hdr[HEADER_LEN];
+  uint8_t prefix[chunked::PREFIX_LEN];
+  uint32_t chunk_len = static_cast<uint32_t>(opt.chunk_len);
+
+  size_t out_len = 0, text_len = 0;
+
+  if (opt.enc) {
+    std::random_device rd;
+    for (size_t i = 0; i < sizeof(prefix); i++) {
+      prefix[i] = static_cast<uint8_t>(rd());
+    }
+
+    write_header(v, chunk_len, prefix, hdr);
+
+    text_len = len;
+    out_len = HEADER_LEN + chunked::sealed_len(len, chunk_len);
+    ok = chunked::chunk_cnt(len, chunk_len) - 1 <=
+         std::numeric_limits<uint32_t>::max();
+  } else {
+    ok = len >= HEADER_LEN && read_header(src, v, chunk_len, prefix) &&
+         chunked::opened_len(len - HEADER_LEN, chunk_len, text_len);
+    out_len = ok ? text_len : 0;
+  }
+
+  uint8_t* dst = nullptr;
+  if (ok && out_len > 0) {
+    if (::ftruncate(out, static_cast<off_t>(out_len)) != 0) {
+      ok = false;
+    } else {
+      void* p = ::mmap(nullptr, out_len, PROT_WRITE, MAP_SHARED, out, 0);
+      if (p == MAP_FAILED) {
+        ok = false;
+      } else {
+        dst = static_cast<uint8_t*>(p);
+      }
+    }
+  }
+
+  if (ok && opt.enc) {
+    std::memcpy(dst, hdr, HEADER_LEN);
+    ok = chunked::encrypt<v>(key,
+                             prefix,
+                             hdr,
+                             HEADER_LEN,
+                             src,
+                             len,
+                             chunk_len,
+                             dst + HEADER_LEN,
+                             &pool);
+  } else if (ok) {
+    ok = chunked::decrypt<v>(key,
+                             prefix,
+                             src,
+                             HEADER_LEN,
+                             src + HEADER_LEN,
+                             len - HEADER_LEN,
+                             chunk_len,
+                             dst,
+                             &pool);
+  }
+
+  if (dst != nullptr) {
+    ::munmap(dst, out_len);
+  }
+  if (src != nullptr) {
+    ::munmap(src, len);
+  }
+
+  rep.bytes = text_len;
+  rep.mapped = true;
+  return true;
+}
+
+// Encrypts/ decrypts input into output, both of which can be pipes, using
+// buffers of many chunks, which are processed on worker pool. Last chunk of
+// each full buffer is held back, until more input is read, so that final
+// chunk can be sealed/ verified as last one. Returns false, if input can't be
+// read, output can't be written or input can't be decrypted.
+template<const variant v>
+bool
+run_streamed(const options_t& opt,
+             const uint8_t* const key,
+             const int in,
+             const int out,
+             parallel::pool& pool,
+             report_t& rep)
+{
+  uint8_t hdr[HEADER_LEN];
+  uint8_t prefix[chunked::PREFIX_LEN];
+  uint32_t chunk_len = static_cast<uint32_t>(opt.chunk_len);
+
+  if (opt.enc) {
+    std::random_device rd;
+    for (size_t i = 0; i < sizeof(prefix); i++) {
+      prefix[i] = static_cast<uint8_t>(rd());
+    }
+
+    write_header(v, chunk_len, prefix, hdr);
+    if (!write_full(out, hdr, HEADER_LEN)) {
+      return false;
+    }
+  } else {
+    if (read_full(in, hdr, HEADER_LEN) != HEADER_LEN ||
+        !read_header(hdr, v, chunk_len, prefix)) {
+      return false;
+    }
+  }
+
+  // input/ output bytes per chunk
+  const size_t full = chunk_len + chunked::TAG_LEN;
+  const size_t iunit = opt.enc ? chunk_len : full;
+  const size_t ounit = opt.enc ? full : chunk_len;
+
+  const size_t k = std::max<size_t>(
+    2, std::min(CHUNKS_PER_THREAD * pool.size(), STREAM_BUF_LEN / iunit));
+
+  std::vector<uint8_t> ibuf(k * iunit), obuf(k * ounit);
+
+  uint64_t first = 0;
+  size_t fill = 0;
+
+  while (true) {
+    const ssize_t n = read_full(in, ibuf.data() + fill, ibuf.size() - fill);
+    if (n < 0) {
+      return false;
+    }
+    fill += static_cast<size_t>(n);
+
+    // input is exhausted only if buffer couldn't be filled
+    const bool last = fill < ibuf.size();
+    const size_t cnt = last ? fill : (k - 1) * iunit;
+
+    size_t olen = 0;
+
+    if (opt.enc) {
+      if (!chunked::encrypt_chunks<v>(key,
+                                      prefix,
+                                      hdr,
+                                      HEADER_LEN,
+                                      first,
+                                      ibuf.data(),
+                                      cnt,
+                                      chunk_len,
+                                      last,
+                                      obuf.data(),
+                                      &pool)) {
+        return false;
+      }
+
+      olen = chunked::sealed_len(cnt, chunk_len);
+      rep.bytes += cnt;
+    } else {
+      if (!chunked::decrypt_chunks<v>(key,
+                                      prefix,
+                                      hdr,
+                                      HEADER_LEN,
+                                      first,
+                                      ibuf.data(),
+                                      cnt,
+                                      chunk_len,
+                                      last,
+                                      obuf.data(),
+                                      &pool)) {
+        return false;
+      }
+
+      chunked::opened_len(cnt, chunk_len, olen);
+      rep.bytes += olen;
+    }
+
+    if (!write_full(out, obuf.data(), olen)) {
+      return false;
+    }
+    if (last) {
+      return true;
+    }
+
+    // hold back last chunk of full buffer, it may turn out to be last one
+    std::memmove(ibuf.data(), ibuf.data() + cnt, iunit);
+
+    fill = iunit;
+    first += k - 1;
+  }
+}
+
+// Encrypts/ decrypts input into output, using TinyJambu-{128, 192, 256},
+// memory mapping them when possible, returning process exit status
+template<const variant v>
+int
+run(const options_t& opt, const uint8_t* const key)
+{
+  const int in = opt.in_path != nullptr ? ::open(opt.in_path, O_RDONLY) : 0;
+  if (in < 0) {
+    std::perror(opt.in_path);
+    return 1;
+  }
+
+  const int out = opt.out_path != nullptr
+                    ? ::open(opt.out_path, O_RDWR | O_CREAT | O_TRUNC, 0644)
+                    : 1;
+  if (out < 0) {
+    std::perror(opt.out_path);
+    return 1;
+  }
+
+  struct stat ist, ost;
+  const bool mappable = ::fstat(in, &ist) == 0 && S_ISREG(ist.st_mode) &&
+                        ::fstat(out, &ost) == 0 && S_ISREG(ost.st_mode);
+
+  parallel::pool pool{ opt.threads };
+  report_t rep;
+  bool ok = false;
+
+  const auto t0 = std::chrono::steady_clock::now();
+
+  if (!(mappable && run_mapped<v>(opt, key, in, out, pool, ok, rep))) {
+    ok = run_streamed<v>(opt, key, in, out, pool, rep);
+  }
+
+  const auto t1 = std::chrono::steady_clock::now();
+  const double secs = std::chrono::duration<double>(t1 - t0).count();
+
+  if (opt.in_path != nullptr) {
+    ::close(in);
+  }
+  if (opt.out_path != nullptr) {
+    ::close(out);
+  }
+
+  if (!ok) {
+    std::fprintf(stderr,
+                 "tjcrypt: %s failed ( malformed/ tampered input or I/O "
+                 "error )\n",
+                 opt.enc ? "encryption" : "decryption");
+
+    // don't leave partially written/ unverified plain text behind
+    if (opt.out_path != nullptr) {
+      ::unlink(opt.out_path);
+    }
+    return 1;
+  }
+
+  std::fprintf(stderr,
+               "tjcrypt: %s %llu bytes in %.3f s, %.2f MB/s ( %s, %zu "
+               "threads )\n",
+               opt.enc ? "encrypted" : "decrypted",
+               static_cast<unsigned long long>(rep.bytes),
+               secs,
+               secs > 0 ? static_cast<double>(rep.bytes) / secs / 1e6 : 0.,
+               rep.mapped ? "mmap" : "stream",
+               pool.size());
+  return 0;
+}
+
+void
+usage()
+{
+  std::fprintf(stderr,
+               "usage: tjcrypt (-e | -d) -k keyfile [-c chunk_len] "
+               "[-t threads] [-i in] [-o out]\n");
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+  options_t opt;
+  bool mode = false;
+  int c = 0;
+
+  while ((c = ::getopt(argc, argv, "edk:c:t:i:o:")) != -1) {
+    switch (c) {
+      case 'e':
+      case 'd':
+        opt.enc = c == 'e';
+        mode = true;
+        break;
+      case 'k':
+        opt.key_path = optarg;
+        break;
+      case 'c':
+        opt.chunk_len = std::strtoull(optarg, nullptr, 10);
+        break;
+      case 't':
+        opt.threads = std::strtoull(optarg, nullptr, 10);
+        break;
+      case 'i':
+        opt.in_path = optarg;
+        break;
+      case 'o':
+        opt.out_path = optarg;
+        break;
+      default:
+        usage();
+        return 2;
+    }
+  }
+
+  if (!mode || opt.key_path == nullptr || optind != argc ||
+      opt.chunk_len == 0 || opt.chunk_len > MAX_CHUNK_LEN || opt.threads == 0) {
+    usage();
+    return 2;
+  }
+
+  // secret key, whose byte length picks variant
+  uint8_t key[33];
+
+  const int kfd = ::open(opt.key_path, O_RDONLY);
+  if (kfd < 0) {
+    std::perror(opt.key_path);
+    return 1;
+  }
+
+  const ssize_t klen = read_full(kfd, key, sizeof(key));
+  ::close(kfd);
+
+  int status = 1;
+
+  switch (klen) {
+    case 16:
+      status = run<variant::key_128>(opt, key);
+      break;
+    case 24:
+      status = run<variant::key_192>(opt, key);
+      break;
+    case 32:
+      status = run<variant::key_256>(opt, key);
+      break;
+    default:
+      std::fprintf(stderr, "tjcrypt: key must be 16, 24 or 32 -bytes\n");
+  }
+
+  std::memset(key, 0, sizeof(key));
+  return status;
+}
@@ -0,0 +1,94 @@
+#include "tinyjambu_128.hpp"
+#include "tinyjambu_192.hpp"
+#include "tinyjambu_256.hpp"
+
+// This translation unit is compiled once per ISA level, selected using ISA
+// specific compiler flags, while `TINYJAMBU_ISA` names it ( say avx2 ). It
+// defines one kernel per feedback bit width ( i.e. 32/ 64/ 128 -bit, all of
+// them without loop or 64 -bit on 64 -bit limbs ), because all of them can be
+// instantiated in same binary.
+// All entry points get prefixed with kernel name ( say fbk64_avx2 ), so that
+// many kernels can live in same shared library object, from which one is picked
+// at load time ( see tinyjambu.cpp ).
+//
+// Note, entry points are marked `flatten`, so that whole AEAD routine gets
+// inlined into them & no out-of-line copy of any ( external linkage ) inline
+// function, compiled for a specific ISA level, is left to be merged by linker
+// with same function from some other ISA level's object.
+//
+// Note, plain/ cipher text pointers of entry points may alias each other, which
+// is used for in-place encryption/ decryption.
+
+#if !defined TINYJAMBU_ISA
+#error "Define TINYJAMBU_ISA to name ISA level of these kernels, say generic"
+#endif
+
+#define KERNEL_FN_(fbk, isa, name) tinyjambu_fbk##fbk##_##isa##_##name
+#define KERNEL_FN(fbk, isa, name) KERNEL_FN_(fbk, isa, name)
+
+#define KERNEL_ATTR __attribute__((flatten, visibility("hidden")))
+
+// Defines encrypt/ decrypt/ verify entry points of TinyJambu-`bits` kernel,
+// computing `fbk` feedback bits per iteration
+#define DEFINE_KERNEL(fbk, bits)                                               \
+  extern "C" KERNEL_ATTR void KERNEL_FN(fbk, TINYJAMBU_ISA, bits##_encrypt)(   \
+    const uint8_t* const __restrict key,                                       \
+    const uint8_t* const __restrict nonce,                                     \
+    const uint8_t* const __restrict data,                                      \
+    const size_t d_len,                                                        \
+    const uint8_t* const text,                                                 \
+    uint8_t* const enc,                                                        \
+    const size_t ct_len,                                                       \
+    uint8_t* const __restrict tag)                                             \
+  {                                                                            \
+    using namespace tinyjambu_##bits;                                          \
+    encrypt<fbk_t::fbk_##fbk>(key, nonce, data, d_len, text, enc, ct_len, tag);\
+  }                                                                            \
+                                                                               \
+  extern "C" KERNEL_ATTR bool KERNEL_FN(fbk, TINYJAMBU_ISA, bits##_decrypt)(   \
+    const uint8_t* const __restrict key,                                       \
+    const uint8_t* const __restrict nonce,                                     \
+    const uint8_t* const __restrict tag,                                       \
+    const uint8_t* const __restrict data,                                      \
+    const size_t d_len,                                                        \
+    const uint8_t* const enc,                                                  \
+    uint8_t* const dec,                                                        \
+    const size_t ct_len)                                                       \
+  {                                                                            \
+    using namespace tinyjambu_##bits;                                          \
+    return decrypt<fbk_t::fbk_##fbk>(                                          \
+      key, nonce, tag, data, d_len, enc, dec, ct_len);                         \
+  }                                                                            \
+                                                                               \
+  extern "C" KERNEL_ATTR bool KERNEL_FN(fbk, TINYJAMBU_ISA, bits##_verify)(    \
+    const uint8_t* const __restrict key,                                       \
+    const uint8_t* const __restrict nonce,                                     \
+    const uint8_t* const __restrict tag,                                       \
+    const uint8_t* const __restrict data,                                      \
+    const size_t d_len,                                                        \
+    const uint8_t* const __restrict enc,                                       \
+    const size_t ct_len)                                                       \
+  {                                                                            \
+    using namespace tinyjambu_##bits;                                          \
+    return verify<fbk_t::fbk_##fbk>(key, nonce, tag, data, d_len, enc, ct_len);\
+  }
+
+DEFINE_KERNEL(32, 128)
+DEFINE_KERNEL(32, 192)
+DEFINE_KERNEL(32, 256)
+
+DEFINE_KERNEL(64, 128)
+DEFINE_KERNEL(64, 192)
+DEFINE_KERNEL(64, 256)
+
+DEFINE_KERNEL(128, 128)
+DEFINE_KERNEL(128, 192)
+DEFINE_KERNEL(128, 256)
+
+DEFINE_KERNEL(all, 128)
+DEFINE_KERNEL(all, 192)
+DEFINE_KERNEL(all, 256)
+
+DEFINE_KERNEL(u64, 128)
+DEFINE_KERNEL(u64, 192)
+DEFINE_KERNEL(u64, 256)
@@ -1,6 +1,191 @@
-#include "tinyjambu_128.hpp"
-#include "tinyjambu_192.hpp"
-#include "tinyjambu_256.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+// Shared library object carries many kernels, one per ( feedback bit width, ISA
+// level ) pair, compiled from kernel.cpp, while public C ABI functions
+// defined in this file forward calls to one of them, picked once at load time.
+//
+// By default, kernel with widest ISA level supported by host CPU is picked (
+// and among those, the one computing all feedback bits without loop, which was
+// fastest on tested CPUs ), while setting environment variable
+// `TINYJAMBU_KERNEL` ( say TINYJAMBU_KERNEL=fbk32_avx2 ) forces a specific one,
+// as long as host CPU supports it, which is useful for benchmarking kernels.
+
+// Authenticated encryption entry point of some kernel, where plain & cipher
+// text may point to same memory
+typedef void(encrypt_fn)(const uint8_t* const __restrict,
+                         const uint8_t* const __restrict,
+                         const uint8_t* const __restrict,
+                         const size_t,
+                         const uint8_t* const,
+                         uint8_t* const,
+                         const size_t,
+                         uint8_t* const __restrict);
+
+// Verified decryption entry point of some kernel, where cipher & plain text
+// may point to same memory
+typedef bool(decrypt_fn)(const uint8_t* const __restrict,
+                         const uint8_t* const __restrict,
+                         const uint8_t* const __restrict,
+                         const uint8_t* const __restrict,
+                         const size_t,
+                         const uint8_t* const,
+                         uint8_t* const,
+                         const size_t);
+
+// Verify-only decryption entry point of some kernel, which never writes plain
+// text
+typedef bool(verify_fn)(const uint8_t* const __restrict,
+                        const uint8_t* const __restrict,
+                        const uint8_t* const __restrict,
+                        const uint8_t* const __restrict,
+                        const size_t,
+                        const uint8_t* const __restrict,
+                        const size_t);
+
+// Declares all entry points of a kernel, compiled from kernel.cpp
+#define DECLARE_KERNEL(name)                                                   \
+  extern "C" encrypt_fn tinyjambu_##name##_128_encrypt;                        \
+  extern "C" decrypt_fn tinyjambu_##name##_128_decrypt;                        \
+  extern "C" verify_fn tinyjambu_##name##_128_verify;                          \
+  extern "C" encrypt_fn tinyjambu_##name##_192_encrypt;                        \
+  extern "C" decrypt_fn tinyjambu_##name##_192_decrypt;                        \
+  extern "C" verify_fn tinyjambu_##name##_192_verify;                          \
+  extern "C" encrypt_fn tinyjambu_##name##_256_encrypt;                        \
+  extern "C" decrypt_fn tinyjambu_##name##_256_decrypt;                        \
+  extern "C" verify_fn tinyjambu_##name##_256_verify;
+
+// ISA level, a kernel is compiled for
+enum class isa_t : uint8_t
+{
+  generic, // baseline instruction set of target architecture
+  avx2,    // x86_64 with AVX2 & BMI{1, 2}
+  avx512,  // x86_64 with AVX-512{F, VL}, AVX2 & BMI{1, 2}
+};
+
+// A kernel, along with its entry points
+struct kernel_t
+{
+  const char* name;
+  isa_t isa;
+  encrypt_fn* encrypt_128;
+  decrypt_fn* decrypt_128;
+  verify_fn* verify_128;
+  encrypt_fn* encrypt_192;
+  decrypt_fn* decrypt_192;
+  verify_fn* verify_192;
+  encrypt_fn* encrypt_256;
+  decrypt_fn* decrypt_256;
+  verify_fn* verify_256;
+};
+
+#define KERNEL(name, isa)                                                      \
+  kernel_t                                                                     \
+  {                                                                            \
+    #name, isa, tinyjambu_##name##_128_encrypt,                                \
+      tinyjambu_##name##_128_decrypt, tinyjambu_##name##_128_verify,           \
+      tinyjambu_##name##_192_encrypt, tinyjambu_##name##_192_decrypt,          \
+      tinyjambu_##name##_192_verify, tinyjambu_##name##_256_encrypt,           \
+      tinyjambu_##name##_256_decrypt, tinyjambu_##name##_256_verify            \
+  }
+
+DECLARE_KERNEL(fbk32_generic)
+DECLARE_KERNEL(fbk64_generic)
+DECLARE_KERNEL(fbk128_generic)
+DECLARE_KERNEL(fbkall_generic)
+DECLARE_KERNEL(fbku64_generic)
+
+#if defined __x86_64__
+DECLARE_KERNEL(fbk32_avx2)
+DECLARE_KERNEL(fbk64_avx2)
+DECLARE_KERNEL(fbk128_avx2)
+DECLARE_KERNEL(fbkall_avx2)
+DECLARE_KERNEL(fbku64_avx2)
+DECLARE_KERNEL(fbk32_avx512)
+DECLARE_KERNEL(fbk64_avx512)
+DECLARE_KERNEL(fbk128_avx512)
+DECLARE_KERNEL(fbkall_avx512)
+DECLARE_KERNEL(fbku64_avx512)
+#endif
+
+// All available kernels, in order of preference
+static const kernel_t KERNELS[]{
+#if defined __x86_64__
+  KERNEL(fbkall_avx512, isa_t::avx512), KERNEL(fbku64_avx512, isa_t::avx512),
+  KERNEL(fbk128_avx512, isa_t::avx512), KERNEL(fbk64_avx512, isa_t::avx512),
+  KERNEL(fbk32_avx512, isa_t::avx512),  KERNEL(fbkall_avx2, isa_t::avx2),
+  KERNEL(fbku64_avx2, isa_t::avx2),     KERNEL(fbk128_avx2, isa_t::avx2),
+  KERNEL(fbk64_avx2, isa_t::avx2),      KERNEL(fbk32_avx2, isa_t::avx2),
+#endif
+  KERNEL(fbkall_generic, isa_t::generic),
+  KERNEL(fbku64_generic, isa_t::generic),
+  KERNEL(fbk128_generic, isa_t::generic),
+  KERNEL(fbk64_generic, isa_t::generic),
+  KERNEL(fbk32_generic, isa_t::generic),
+};
+
+// Checks whether host CPU supports ISA level, required by given kernel
+static bool
+is_supported(const kernel_t& k)
+{
+#if defined __x86_64__
+  __builtin_cpu_init();
+
+  const bool avx2 = __builtin_cpu_supports("avx2") &&
+                    __builtin_cpu_supports("bmi") &&
+                    __builtin_cpu_supports("bmi2");
+  const bool avx512 = avx2 && __builtin_cpu_supports("avx512f") &&
+                      __builtin_cpu_supports("avx512vl");
+
+  switch (k.isa) {
+    case isa_t::avx512:
+      return avx512;
+    case isa_t::avx2:
+      return avx2;
+    case isa_t::generic:
+      return true;
+  }
+  return false;
+#else
+  return k.isa == isa_t::generic;
+#endif
+}
+
+// Picks kernel requested using `TINYJAMBU_KERNEL` environment variable, if
+// it's available & supported by host CPU, otherwise picks most preferred one
+// among supported kernels
+static const kernel_t&
+select_kernel()
+{
+  const char* const req = std::getenv("TINYJAMBU_KERNEL");
+
+  if (req != nullptr) {
+    for (const kernel_t& k : KERNELS) {
+      if (std::strcmp(k.name, req) == 0 && is_supported(k)) {
+        return k;
+      }
+    }
+  }
+
+  for (const kernel_t& k : KERNELS) {
+    if (is_supported(k)) {
+      return k;
+    }
+  }
+
+  // generic kernels are always supported, so this is never reached
+  std::abort();
+}
+
+// Kernel to be used for all C ABI calls, selected on first use
+static const kernel_t&
+kernel()
+{
+  static const kernel_t& k = select_kernel();
+  return k;
+}
 
 // Declare function prototypes
 extern "C"
@@ -24,6 +209,46 @@ extern "C"
                              uint8_t* const __restrict,
                              const size_t);
 
+  void tinyjambu_128_encrypt_inplace(const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const size_t,
+                                     uint8_t* const __restrict,
+                                     const size_t,
+                                     uint8_t* const __restrict);
+
+  bool tinyjambu_128_decrypt_inplace(const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const size_t,
+                                     uint8_t* const __restrict,
+                                     const size_t);
+
+  bool tinyjambu_128_verify(const uint8_t* const __restrict,
+                            const uint8_t* const __restrict,
+                            const uint8_t* const __restrict,
+                            const uint8_t* const __restrict,
+                            const size_t,
+                            const uint8_t* const __restrict,
+                            const size_t);
+
+  void tinyjambu_128_seal(const uint8_t* const __restrict,
+                          const uint8_t* const __restrict,
+                          const uint8_t* const __restrict,
+                          const size_t,
+                          const uint8_t* const,
+                          const size_t,
+                          uint8_t* const);
+
+  bool tinyjambu_128_open(const uint8_t* const __restrict,
+                          const uint8_t* const __restrict,
+                          const uint8_t* const __restrict,
+                          const size_t,
+                          const uint8_t* const,
+                          const size_t,
+                          uint8_t* const);
+
   void tinyjambu_192_encrypt(const uint8_t* const __restrict,
                              const uint8_t* const __restrict,
                              const uint8_t* const __restrict,
@@ -42,6 +267,46 @@ extern "C"
                              uint8_t* const __restrict,
                              const size_t);
 
+  void tinyjambu_192_encrypt_inplace(const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const size_t,
+                                     uint8_t* const __restrict,
+                                     const size_t,
+                                     uint8_t* const __restrict);
+
+  bool tinyjambu_192_decrypt_inplace(const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const size_t,
+                                     uint8_t* const __restrict,
+                                     const size_t);
+
+  bool tinyjambu_192_verify(const uint8_t* const __restrict,
+                            const uint8_t* const __restrict,
+                            const uint8_t* const __restrict,
+                            const uint8_t* const __restrict,
+                            const size_t,
+                            const uint8_t* const __restrict,
+                            const size_t);
+
+  void tinyjambu_192_seal(const uint8_t* const __restrict,
+                          const uint8_t* const __restrict,
+                          const uint8_t* const __restrict,
+                          const size_t,
+                          const uint8_t* const,
+                          const size_t,
+                          uint8_t* const);
+
+  bool tinyjambu_192_open(const uint8_t* const __restrict,
+                          const uint8_t* const __restrict,
+                          const uint8_t* const __restrict,
+                          const size_t,
+                          const uint8_t* const,
+                          const size_t,
+                          uint8_t* const);
+
   void tinyjambu_256_encrypt(const uint8_t* const __restrict,
                              const uint8_t* const __restrict,
                              const uint8_t* const __restrict,
@@ -59,6 +324,48 @@ extern "C"
                              const uint8_t* const __restrict,
                              uint8_t* const __restrict,
                              const size_t);
+
+  void tinyjambu_256_encrypt_inplace(const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const size_t,
+                                     uint8_t* const __restrict,
+                                     const size_t,
+                                     uint8_t* const __restrict);
+
+  bool tinyjambu_256_decrypt_inplace(const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const uint8_t* const __restrict,
+                                     const size_t,
+                                     uint8_t* const __restrict,
+                                     const size_t);
+
+  bool tinyjambu_256_verify(const uint8_t* const __restrict,
+                            const uint8_t* const __restrict,
+                            const uint8_t* const __restrict,
+                            const uint8_t* const __restrict,
+                            const size_t,
+                            const uint8_t* const __restrict,
+                            const size_t);
+
+  void tinyjambu_256_seal(const uint8_t* const __restrict,
+                          const uint8_t* const __restrict,
+                          const uint8_t* const __restrict,
+                          const size_t,
+                          const uint8_t* const,
+                          const size_t,
+                          uint8_t* const);
+
+  bool tinyjambu_256_open(const uint8_t* const __restrict,
+                          const uint8_t* const __restrict,
+                          const uint8_t* const __restrict,
+                          const size_t,
+                          const uint8_t* const,
+                          const size_t,
+                          uint8_t* const);
+
+  const char* tinyjambu_kernel();
 }
 
 // Declare function body
@@ -67,7 +374,7 @@ extern "C"
 
   // Authenticated encryption using TinyJambu-128, just a thin wrapper on top of
   // https://github.com/itzmeanjan/tinyjambu/blob/4ebaea64dfa3398aab0ee2348dd5750dc70f6059/include/tinyjambu_128.hpp#L7-L40
-  // to ensure generation of C ABI
+  // ( via kernel picked at load time ), to ensure generation of C ABI
   void tinyjambu_128_encrypt(
     const uint8_t* const __restrict key,   // 16 -bytes secret key
     const uint8_t* const __restrict nonce, // 12 -bytes nonce
@@ -79,12 +386,12 @@ extern "C"
     uint8_t* const __restrict tag          // 8 -bytes authentication tag
   )
   {
-    tinyjambu_128::encrypt(key, nonce, data, d_len, text, enc, ct_len, tag);
+    kernel().encrypt_128(key, nonce, data, d_len, text, enc, ct_len, tag);
   }
 
   // Verified decryption using TinyJambu-128, just a thin wrapper on top of
   // https://github.com/itzmeanjan/tinyjambu/blob/4ebaea64dfa3398aab0ee2348dd5750dc70f6059/include/tinyjambu_128.hpp#L42-L85
-  // to ensure generation of C ABI
+  // ( via kernel picked at load time ), to ensure generation of C ABI
   bool tinyjambu_128_decrypt(
     const uint8_t* const __restrict key,   // 16 -bytes secret key
     const uint8_t* const __restrict nonce, // 12 -bytes nonce
@@ -96,15 +403,99 @@ extern "C"
     const size_t ct_len                    // M = len(enc) or len(dec) | M >= 0
   )
   {
-    using namespace tinyjambu_128;
+    return kernel().decrypt_128(key, nonce, tag, data, d_len, enc, dec, ct_len);
+  }
+
+  // In-place authenticated encryption using TinyJambu-128, where plain text
+  // in `buf` is overwritten with cipher text ( via kernel picked at load time )
+  void tinyjambu_128_encrypt_inplace(
+    const uint8_t* const __restrict key,   // 16 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    uint8_t* const __restrict buf,         // M -bytes plain/ cipher text
+    const size_t ct_len,                   // M = len(buf) | M >= 0
+    uint8_t* const __restrict tag          // 8 -bytes authentication tag
+  )
+  {
+    kernel().encrypt_128(key, nonce, data, d_len, buf, buf, ct_len, tag);
+  }
+
+  // In-place verified decryption using TinyJambu-128, where cipher text in
+  // `buf` is overwritten with plain text ( or zeroed, if verification fails )
+  bool tinyjambu_128_decrypt_inplace(
+    const uint8_t* const __restrict key,   // 16 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict tag,   // 8 -bytes authentication tag
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    uint8_t* const __restrict buf,         // M -bytes cipher/ plain text
+    const size_t ct_len                    // M = len(buf) | M >= 0
+  )
+  {
+    return kernel().decrypt_128(key, nonce, tag, data, d_len, buf, buf, ct_len);
+  }
+
+  // Verify-only decryption using TinyJambu-128, which checks authenticity of
+  // cipher text, without writing any plain text ( via kernel picked at load
+  // time )
+  bool tinyjambu_128_verify(
+    const uint8_t* const __restrict key,   // 16 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict tag,   // 8 -bytes authentication tag
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    const uint8_t* const __restrict enc,   // M -bytes cipher text
+    const size_t ct_len                    // M = len(enc) | M >= 0
+  )
+  {
+    return kernel().verify_128(key, nonce, tag, data, d_len, enc, ct_len);
+  }
+
+  // Authenticated encryption using TinyJambu-128, writing cipher text followed
+  // by authentication tag to single buffer, where `text` & `sealed` may point
+  // to same memory ( via kernel picked at load time )
+  void tinyjambu_128_seal(
+    const uint8_t* const __restrict key,   // 16 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    const uint8_t* const text,             // M -bytes plain text
+    const size_t ct_len,                   // M = len(text) | M >= 0
+    uint8_t* const sealed                  // M + 8 -bytes cipher text || tag
+  )
+  {
+    uint8_t* const tag = sealed + ct_len;
+    kernel().encrypt_128(key, nonce, data, d_len, text, sealed, ct_len, tag);
+  }
+
+  // Verified decryption using TinyJambu-128, reading cipher text followed by
+  // authentication tag from single buffer, where `sealed` & `text` may point
+  // to same memory ( via kernel picked at load time )
+  bool tinyjambu_128_open(
+    const uint8_t* const __restrict key,   // 16 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    const uint8_t* const sealed,           // M + 8 -bytes cipher text || tag
+    const size_t s_len,                    // M + 8 = len(sealed) | M >= 0
+    uint8_t* const text                    // M -bytes plain text
+  )
+  {
+    if (s_len < 8) {
+      return false;
+    }
+
+    const size_t ct_len = s_len - 8;
+    const uint8_t* const tag = sealed + ct_len;
 
-    const bool f = decrypt(key, nonce, tag, data, d_len, enc, dec, ct_len);
-    return f;
+    return kernel().decrypt_128(
+      key, nonce, tag, data, d_len, sealed, text, ct_len);
   }
 
   // Authenticated encryption using TinyJambu-192, just a thin wrapper on top of
   // https://github.com/itzmeanjan/tinyjambu/blob/4ebaea64dfa3398aab0ee2348dd5750dc70f6059/include/tinyjambu_192.hpp#L7-L40
-  // to ensure generation of C ABI
+  // ( via kernel picked at load time ), to ensure generation of C ABI
   void tinyjambu_192_encrypt(
     const uint8_t* const __restrict key,   // 24 -bytes secret key
     const uint8_t* const __restrict nonce, // 12 -bytes nonce
@@ -116,12 +507,12 @@ extern "C"
     uint8_t* const __restrict tag          // 8 -bytes authentication tag
   )
   {
-    tinyjambu_192::encrypt(key, nonce, data, d_len, text, enc, ct_len, tag);
+    kernel().encrypt_192(key, nonce, data, d_len, text, enc, ct_len, tag);
   }
 
   // Verified decryption using TinyJambu-192, just a thin wrapper on top of
   // https://github.com/itzmeanjan/tinyjambu/blob/4ebaea64dfa3398aab0ee2348dd5750dc70f6059/include/tinyjambu_192.hpp#L42-L85
-  // to ensure generation of C ABI
+  // ( via kernel picked at load time ), to ensure generation of C ABI
   bool tinyjambu_192_decrypt(
     const uint8_t* const __restrict key,   // 24 -bytes secret key
     const uint8_t* const __restrict nonce, // 12 -bytes nonce
@@ -133,15 +524,99 @@ extern "C"
     const size_t ct_len                    // M = len(enc) or len(dec) | M >= 0
   )
   {
-    using namespace tinyjambu_192;
+    return kernel().decrypt_192(key, nonce, tag, data, d_len, enc, dec, ct_len);
+  }
+
+  // In-place authenticated encryption using TinyJambu-192, where plain text
+  // in `buf` is overwritten with cipher text ( via kernel picked at load time )
+  void tinyjambu_192_encrypt_inplace(
+    const uint8_t* const __restrict key,   // 24 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    uint8_t* const __restrict buf,         // M -bytes plain/ cipher text
+    const size_t ct_len,                   // M = len(buf) | M >= 0
+    uint8_t* const __restrict tag          // 8 -bytes authentication tag
+  )
+  {
+    kernel().encrypt_192(key, nonce, data, d_len, buf, buf, ct_len, tag);
+  }
+
+  // In-place verified decryption using TinyJambu-192, where cipher text in
+  // `buf` is overwritten with plain text ( or zeroed, if verification fails )
+  bool tinyjambu_192_decrypt_inplace(
+    const uint8_t* const __restrict key,   // 24 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict tag,   // 8 -bytes authentication tag
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    uint8_t* const __restrict buf,         // M -bytes cipher/ plain text
+    const size_t ct_len                    // M = len(buf) | M >= 0
+  )
+  {
+    return kernel().decrypt_192(key, nonce, tag, data, d_len, buf, buf, ct_len);
+  }
+
+  // Verify-only decryption using TinyJambu-192, which checks authenticity of
+  // cipher text, without writing any plain text ( via kernel picked at load
+  // time )
+  bool tinyjambu_192_verify(
+    const uint8_t* const __restrict key,   // 24 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict tag,   // 8 -bytes authentication tag
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    const uint8_t* const __restrict enc,   // M -bytes cipher text
+    const size_t ct_len                    // M = len(enc) | M >= 0
+  )
+  {
+    return kernel().verify_192(key, nonce, tag, data, d_len, enc, ct_len);
+  }
 
-    const bool f = decrypt(key, nonce, tag, data, d_len, enc, dec, ct_len);
-    return f;
+  // Authenticated encryption using TinyJambu-192, writing cipher text followed
+  // by authentication tag to single buffer, where `text` & `sealed` may point
+  // to same memory ( via kernel picked at load time )
+  void tinyjambu_192_seal(
+    const uint8_t* const __restrict key,   // 24 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    const uint8_t* const text,             // M -bytes plain text
+    const size_t ct_len,                   // M = len(text) | M >= 0
+    uint8_t* const sealed                  // M + 8 -bytes cipher text || tag
+  )
+  {
+    uint8_t* const tag = sealed + ct_len;
+    kernel().encrypt_192(key, nonce, data, d_len, text, sealed, ct_len, tag);
+  }
+
+  // Verified decryption using TinyJambu-192, reading cipher text followed by
+  // authentication tag from single buffer, where `sealed` & `text` may point
+  // to same memory ( via kernel picked at load time )
+  bool tinyjambu_192_open(
+    const uint8_t* const __restrict key,   // 24 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    const uint8_t* const sealed,           // M + 8 -bytes cipher text || tag
+    const size_t s_len,                    // M + 8 = len(sealed) | M >= 0
+    uint8_t* const text                    // M -bytes plain text
+  )
+  {
+    if (s_len < 8) {
+      return false;
+    }
+
+    const size_t ct_len = s_len - 8;
+    const uint8_t* const tag = sealed + ct_len;
+
+    return kernel().decrypt_192(
+      key, nonce, tag, data, d_len, sealed, text, ct_len);
   }
 
   // Authenticated encryption using TinyJambu-256, just a thin wrapper on top of
   // https://github.com/itzmeanjan/tinyjambu/blob/4ebaea64dfa3398aab0ee2348dd5750dc70f6059/include/tinyjambu_256.hpp#L7-L40
-  // to ensure generation of C ABI
+  // ( via kernel picked at load time ), to ensure generation of C ABI
   void tinyjambu_256_encrypt(
     const uint8_t* const __restrict key,   // 32 -bytes secret key
     const uint8_t* const __restrict nonce, // 12 -bytes nonce
@@ -153,12 +628,12 @@ extern "C"
     uint8_t* const __restrict tag          // 8 -bytes authentication tag
   )
   {
-    tinyjambu_256::encrypt(key, nonce, data, d_len, text, enc, ct_len, tag);
+    kernel().encrypt_256(key, nonce, data, d_len, text, enc, ct_len, tag);
   }
 
   // Verified decryption using TinyJambu-256, just a thin wrapper on top of
   // https://github.com/itzmeanjan/tinyjambu/blob/4ebaea64dfa3398aab0ee2348dd5750dc70f6059/include/tinyjambu_256.hpp#L42-L85
-  // to ensure generation of C ABI
+  // ( via kernel picked at load time ), to ensure generation of C ABI
   bool tinyjambu_256_decrypt(
     const uint8_t* const __restrict key,   // 32 -bytes secret key
     const uint8_t* const __restrict nonce, // 12 -bytes nonce
@@ -170,9 +645,96 @@ extern "C"
     const size_t ct_len                    // M = len(enc) or len(dec) | M >= 0
   )
   {
-    using namespace tinyjambu_256;
+    return kernel().decrypt_256(key, nonce, tag, data, d_len, enc, dec, ct_len);
+  }
 
-    const bool f = decrypt(key, nonce, tag, data, d_len, enc, dec, ct_len);
-    return f;
+  // In-place authenticated encryption using TinyJambu-256, where plain text
+  // in `buf` is overwritten with cipher text ( via kernel picked at load time )
+  void tinyjambu_256_encrypt_inplace(
+    const uint8_t* const __restrict key,   // 32 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    uint8_t* const __restrict buf,         // M -bytes plain/ cipher text
+    const size_t ct_len,                   // M = len(buf) | M >= 0
+    uint8_t* const __restrict tag          // 8 -bytes authentication tag
+  )
+  {
+    kernel().encrypt_256(key, nonce, data, d_len, buf, buf, ct_len, tag);
   }
+
+  // In-place verified decryption using TinyJambu-256, where cipher text in
+  // `buf` is overwritten with plain text ( or zeroed, if verification fails )
+  bool tinyjambu_256_decrypt_inplace(
+    const uint8_t* const __restrict key,   // 32 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict tag,   // 8 -bytes authentication tag
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    uint8_t* const __restrict buf,         // M -bytes cipher/ plain text
+    const size_t ct_len                    // M = len(buf) | M >= 0
+  )
+  {
+    return kernel().decrypt_256(key, nonce, tag, data, d_len, buf, buf, ct_len);
+  }
+
+  // Verify-only decryption using TinyJambu-256, which checks authenticity of
+  // cipher text, without writing any plain text ( via kernel picked at load
+  // time )
+  bool tinyjambu_256_verify(
+    const uint8_t* const __restrict key,   // 32 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict tag,   // 8 -bytes authentication tag
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    const uint8_t* const __restrict enc,   // M -bytes cipher text
+    const size_t ct_len                    // M = len(enc) | M >= 0
+  )
+  {
+    return kernel().verify_256(key, nonce, tag, data, d_len, enc, ct_len);
+  }
+
+  // Authenticated encryption using TinyJambu-256, writing cipher text followed
+  // by authentication tag to single buffer, where `text` & `sealed` may point
+  // to same memory ( via kernel picked at load time )
+  void tinyjambu_256_seal(
+    const uint8_t* const __restrict key,   // 32 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    const uint8_t* const text,             // M -bytes plain text
+    const size_t ct_len,                   // M = len(text) | M >= 0
+    uint8_t* const sealed                  // M + 8 -bytes cipher text || tag
+  )
+  {
+    uint8_t* const tag = sealed + ct_len;
+    kernel().encrypt_256(key, nonce, data, d_len, text, sealed, ct_len, tag);
+  }
+
+  // Verified decryption using TinyJambu-256, reading cipher text followed by
+  // authentication tag from single buffer, where `sealed` & `text` may point
+  // to same memory ( via kernel picked at load time )
+  bool tinyjambu_256_open(
+    const uint8_t* const __restrict key,   // 32 -bytes secret key
+    const uint8_t* const __restrict nonce, // 12 -bytes nonce
+    const uint8_t* const __restrict data,  // N -bytes associated data
+    const size_t d_len,                    // N = len(data) | N >= 0
+    const uint8_t* const sealed,           // M + 8 -bytes cipher text || tag
+    const size_t s_len,                    // M + 8 = len(sealed) | M >= 0
+    uint8_t* const text                    // M -bytes plain text
+  )
+  {
+    if (s_len < 8) {
+      return false;
+    }
+
+    const size_t ct_len = s_len - 8;
+    const uint8_t* const tag = sealed + ct_len;
+
+    return kernel().decrypt_256(
+      key, nonce, tag, data, d_len, sealed, text, ct_len);
+  }
+
+  // Name of kernel, serving all C ABI calls, say fbk128_avx2
+  const char* tinyjambu_kernel() { return kernel().name; }
 }